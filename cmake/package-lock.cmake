@@ -62,6 +62,18 @@ CPMDeclarePackage (googletest
                    OPTIONS "BUILD_GMOCK OFF" "INSTALL_GTEST OFF" "CMAKE_MESSAGE_LOG_LEVEL WARNING"
 )
 
+# googlebenchmark
+set (GOOGLEBENCHMARK_VERSION 1.9.1 CACHE STRING "" FORCE)
+CPMDeclarePackage (googlebenchmark
+                   NAME benchmark
+                   VERSION ${GOOGLEBENCHMARK_VERSION}
+                   GITHUB_REPOSITORY google/benchmark
+                   SYSTEM TRUE
+                   EXCLUDE_FROM_ALL TRUE
+                   OPTIONS "BENCHMARK_ENABLE_TESTING OFF" "BENCHMARK_ENABLE_INSTALL OFF" "BENCHMARK_ENABLE_WERROR OFF"
+                           "CMAKE_MESSAGE_LOG_LEVEL WARNING"
+)
+
 # use_ccache
 set (USE_CCACHE_VERSION d2a54ef555b6fc2d496a4c9506dbeb7cf899ce37 CACHE STRING "" FORCE)
 CPMDeclarePackage (use_ccache
@@ -0,0 +1,84 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <span>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+/* Compressed payload layout:
+ *   block 0 | block 1 | ... | block n-1 | compressed size of each block (n * uint64_t) | trailer
+ * The trailer holds the (uncompressed) block size, n, and the total uncompressed size, each as uint64_t.
+ * Blocks are compressed independently with zlib, which allows compressing and decompressing them in parallel.
+ */
+
+//!\brief Whether this build can read and write compressed indexes.
+bool block_compression_available() noexcept;
+
+//!\brief Throws if this build cannot read and write compressed indexes.
+void check_block_compression_available();
+
+//!\brief Compresses everything written to it. Buffers up to `threads` blocks and compresses them in parallel.
+class block_compressing_buffer : public std::streambuf
+{
+public:
+    static constexpr size_t default_block_size{1ULL << 22};
+
+    block_compressing_buffer() = delete;
+    block_compressing_buffer(block_compressing_buffer const &) = delete;
+    block_compressing_buffer & operator=(block_compressing_buffer const &) = delete;
+    block_compressing_buffer(block_compressing_buffer &&) = delete;
+    block_compressing_buffer & operator=(block_compressing_buffer &&) = delete;
+    ~block_compressing_buffer() override = default;
+
+    block_compressing_buffer(std::ostream & stream,
+                             size_t const threads,
+                             size_t const block_size = default_block_size);
+
+    //!\brief Compresses the remaining data and writes the block sizes and the trailer. Must be called once at the end.
+    void finish();
+
+protected:
+    int_type overflow(int_type const character) override;
+
+private:
+    void compress_buffer();
+
+    std::ostream & stream;
+    size_t threads{};
+    size_t block_size{};
+    std::vector<char> buffer{};
+    std::vector<std::string> compressed_blocks{};
+    std::vector<uint64_t> compressed_sizes{};
+    uint64_t uncompressed_size{};
+};
+
+//!\brief Decompresses a payload written by block_compressing_buffer. Decompresses up to `threads` blocks in parallel.
+class block_decompressing_buffer : public std::streambuf
+{
+public:
+    block_decompressing_buffer() = delete;
+    block_decompressing_buffer(block_decompressing_buffer const &) = delete;
+    block_decompressing_buffer & operator=(block_decompressing_buffer const &) = delete;
+    block_decompressing_buffer(block_decompressing_buffer &&) = delete;
+    block_decompressing_buffer & operator=(block_decompressing_buffer &&) = delete;
+    ~block_decompressing_buffer() override = default;
+
+    block_decompressing_buffer(std::span<char const> const payload, size_t const threads);
+
+protected:
+    int_type underflow() override;
+
+private:
+    std::vector<std::span<char const>> blocks{};
+    size_t next_block{};
+    size_t threads{};
+    uint64_t block_size{};
+    uint64_t uncompressed_size{};
+    std::vector<char> buffer{};
+};
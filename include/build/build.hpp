@@ -4,6 +4,12 @@
 
 #pragma once
 
+#include <string>
+#include <vector>
+
 #include "configuration.hpp"
 
 void build(configuration const & config);
+
+// Reads the file list. Throws if it is empty or contains invalid entries.
+std::vector<std::string> parse_user_bins(std::filesystem::path const & file);
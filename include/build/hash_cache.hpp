@@ -0,0 +1,61 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#pragma once
+
+#include <atomic>
+#include <filesystem>
+#include <vector>
+
+#include <hibf/config.hpp>
+
+/*!\brief Keeps the hashes of each user bin between the passes of the HIBF construction.
+ * \details
+ * The HIBF calls the input function once per user bin to compute the layout and at least once more to fill the
+ * filters. The first call stores the sorted and deduplicated hashes of a user bin. As long as the stored hashes fit
+ * into `memory_budget` bytes, they are kept in memory; otherwise they are written to a file in a temporary directory.
+ * Later calls read the stored hashes instead of parsing and hashing the input again.
+ * Different user bins may be stored and read concurrently.
+ */
+class hash_cache
+{
+public:
+    hash_cache() = delete;
+    hash_cache(hash_cache const &) = delete;
+    hash_cache & operator=(hash_cache const &) = delete;
+    hash_cache(hash_cache &&) = delete;
+    hash_cache & operator=(hash_cache &&) = delete;
+
+    hash_cache(size_t const number_of_user_bins,
+               size_t const memory_budget,
+               std::filesystem::path const & tmp_directory);
+
+    //!\brief Removes the spill files.
+    ~hash_cache();
+
+    //!\brief Writes the stored hashes of `user_bin_id` to `it`. Returns false if there are none.
+    bool read(size_t const user_bin_id, seqan::hibf::insert_iterator & it) const;
+
+    //!\brief Sorts and deduplicates `hashes` in place and stores them for `user_bin_id`.
+    void store(size_t const user_bin_id, std::vector<uint64_t> & hashes);
+
+    //!\brief The number of user bins whose hashes were written to disk.
+    size_t spilled_user_bins() const noexcept;
+
+private:
+    enum class entry_state : uint8_t
+    {
+        missing,
+        in_memory,
+        spilled
+    };
+
+    std::filesystem::path spill_path(size_t const user_bin_id) const;
+
+    size_t memory_budget{};
+    std::atomic<size_t> memory_used{};
+    std::filesystem::path spill_directory{};
+    std::vector<std::atomic<entry_state>> states{};
+    std::vector<std::vector<uint64_t>> in_memory{};
+};
@@ -0,0 +1,37 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "configuration.hpp"
+
+/*!\brief How `build` stays within `--max_memory`.
+ * \details
+ * The HIBF constructor builds the whole index at once, so the filters must fit into memory. Their size is estimated
+ * from a sample build (see `estimate_index_size`) and taken from the budget first. What can be bounded within the rest
+ * are the intermediate hashes: each thread holds the hashes of one user bin (and of the merged bins above it), and the
+ * hash cache keeps the hashes of all user bins between the construction passes. The number of threads is reduced such
+ * that the largest user bins of all threads fit into half of the rest. A quarter of the rest goes to the hash cache,
+ * which spills everything beyond it to disk. The last quarter is left for the layout and I/O.
+ */
+struct memory_plan
+{
+    uint16_t threads{};
+    uint64_t cache_memory{}; // MiB
+    uint64_t index_size{}; // Estimated bytes of the filters.
+    uint64_t largest_user_bin{}; // Estimated bytes of intermediate data while processing the largest user bin.
+};
+
+//!\brief The expected number of hashes per base of a sequence.
+double hash_density(configuration const & config);
+
+//!\brief Plans a build of `user_bin_paths` with filters of `index_size` bytes within `config.max_memory` MiB.
+//!\throws std::runtime_error if the filters and the largest user bin do not fit.
+memory_plan plan_memory(configuration const & config,
+                        std::vector<std::string> const & user_bin_paths,
+                        uint64_t const index_size);
@@ -0,0 +1,36 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "configuration.hpp"
+
+// One HIBF configuration considered by `tune`.
+struct tuning_candidate
+{
+    uint8_t number_of_hash_functions{};
+    double maximum_fpr{};
+    uint64_t index_size{};  // Estimated bytes for all user bins.
+    double query_cost{};    // Estimated 64-bit words read per query hash.
+};
+
+// Builds HIBFs for a sample of the user bins with several numbers of hash functions and false positive rates (at
+// most `config.relaxed_fpr`), extrapolates their size to all user bins, and estimates their query cost. Sets
+// `config.number_of_hash_functions` and `config.maximum_fpr` to the cheapest candidate within `config.tune_memory`,
+// or to the smallest candidate within `config.tune_query_cost`. Prints all candidates.
+void tune(configuration & config, std::vector<std::string> const & user_bin_paths);
+
+// Builds an HIBF for a sample of `config.tune_sample` user bins with the configured number of hash functions and false
+// positive rate, and extrapolates its size in bytes to all user bins.
+uint64_t estimate_index_size(configuration const & config, std::vector<std::string> const & user_bin_paths);
+
+// The expected number of 64-bit words read per query hash: each queried IBF fetches `tmax` bits per hash function.
+// Below the root, false positives of merged bins (at rate `maximum_fpr`) add IBFs to query.
+double estimate_query_cost(uint8_t number_of_hash_functions,
+                           double maximum_fpr,
+                           uint64_t number_of_user_bins,
+                           uint64_t tmax);
@@ -4,7 +4,9 @@
 
 #pragma once
 
+#include <cstdint>
 #include <filesystem>
+#include <vector>
 
 enum class hash_type : uint8_t
 {
@@ -13,17 +15,51 @@ enum class hash_type : uint8_t
     syncmer
 };
 
+enum class result_format : uint8_t
+{
+    text,  // `id: [0,1,2]`
+    tsv,   // One hit per row: `id<TAB>user bin`
+    binary // Per read: read index, number of user bins, user bins; all as varints.
+};
+
 struct configuration
 {
     std::filesystem::path file_list_path{};
     std::filesystem::path index_output{"index"};
+    std::filesystem::path hash_output_directory{"hashes"};
+    bool compress_index{false};
+    bool cache_hashes{false};
+    uint64_t cache_memory{1024u}; // MiB
+    std::filesystem::path tmp_directory{}; // Empty means std::filesystem::temp_directory_path().
+    uint64_t max_memory{}; // MiB; 0 means no limit.
+    uint8_t number_of_hash_functions{2u};
+    double maximum_fpr{0.05};
+    double relaxed_fpr{0.3};
+    uint64_t tmax{}; // 0 means sqrt(number of user bins), rounded up to a multiple of 64.
+    double alpha{1.2};
+    bool tune{false};
+    uint64_t tune_memory{};   // MiB; 0 means no limit.
+    double tune_query_cost{}; // 0 means no limit.
+    uint64_t tune_sample{64u};
     uint8_t kmer_size{20u};
     std::filesystem::path reads{};
     std::filesystem::path search_output{"output.txt"};
+    bool print_results{false};
+    result_format output_format{result_format::text};
+    bool count_hashes{false}; // Report hash counts per user bin instead of user bins.
     std::filesystem::path index_file{};
     uint8_t error{0u};
     hash_type hash{hash_type::invalid};
     uint8_t window_size{20u};
     uint8_t s{11u};
     uint8_t t{2u};
+    uint16_t threads{1u};
+    std::filesystem::path threshold_cache{};
+    bool verify_checksum{false};
+    std::vector<uint64_t> user_bins_to_remove{};
+    std::filesystem::path stats_output{}; // Empty means no statistics.
+    std::filesystem::path socket_path{"HIBF-hashing.sock"};
+    bool shutdown_server{false};
+    uint64_t max_request_size{1024u}; // MiB
+    uint32_t idle_timeout{60u};       // Seconds; 0 means no timeout.
 };
@@ -8,7 +8,7 @@
 #pragma once
 
 #include <algorithm>
-#include <deque>
+#include <array>
 
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
 #include <seqan3/core/range/detail/adaptor_from_functor.hpp>
@@ -24,6 +24,47 @@ struct syncmer_params
     size_t offset{};
 };
 
+/*!\brief A ring buffer holding the s-mer values of the current k-mer.
+ * \tparam prefer_first Whether ties are resolved in favour of the first (oldest) or last (most recent) occurrence.
+ * \details
+ * Values are addressed by their index since the start of the text. A k-mer contains `kmer_size - smer_size + 1 <= 32`
+ * s-mers, hence, a fixed capacity of 32 suffices. The buffer never allocates and copying it is a plain copy.
+ */
+template <bool prefer_first>
+class smer_window
+{
+public:
+    static constexpr size_t capacity{32u};
+
+    void set(size_t const index, uint64_t const value) noexcept
+    {
+        values[index % capacity] = value;
+    }
+
+    //!\brief Finds the minimal value with an index in `[first_index, last_index]`.
+    void find_minimum(size_t const first_index,
+                      size_t const last_index,
+                      uint64_t & min_value,
+                      size_t & min_index) const noexcept
+    {
+        min_value = values[first_index % capacity];
+        min_index = first_index;
+
+        for (size_t index = first_index + 1u; index <= last_index; ++index)
+        {
+            uint64_t const value = values[index % capacity];
+            if (prefer_first ? value < min_value : value <= min_value)
+            {
+                min_value = value;
+                min_index = index;
+            }
+        }
+    }
+
+private:
+    std::array<uint64_t, capacity> values{};
+};
+
 template <std::ranges::view urng_t>
 class syncmer_view : public std::ranges::view_interface<syncmer_view<urng_t>>
 {
@@ -103,16 +144,23 @@ private:
     size_t fwd_smer_mask{};
     size_t rc_kmer_shift{};
     size_t rc_smer_shift{};
+    size_t smers_per_kmer{};
 
     value_type fwd_min_smer_value{};
     value_type rc_min_smer_value{};
     value_type fwd_kmer_value{};
     value_type rc_kmer_value{};
+    value_type fwd_smer_value{};
+    value_type rc_smer_value{};
     value_type syncmer_value{};
-    size_t fwd_smer_position{};
-    size_t rc_smer_position{};
-    std::deque<value_type> fwd_smer_values{};
-    std::deque<value_type> rc_smer_values{};
+    // Indices count the s-mers since the start of the text. The current k-mer contains the s-mers
+    // [smer_count - smers_per_kmer, smer_count).
+    size_t smer_count{};
+    size_t fwd_min_smer_index{};
+    size_t rc_min_smer_index{};
+    // On ties, the forward strand prefers the last occurrence, the reverse complement the first one.
+    smer_window<false> fwd_smer_values{};
+    smer_window<true> rc_smer_values{};
 
 public:
     basic_iterator() = default;
@@ -132,12 +180,17 @@ public:
         fwd_smer_mask{std::move(it.fwd_smer_mask)},
         rc_kmer_shift{std::move(it.rc_kmer_shift)},
         rc_smer_shift{std::move(it.rc_smer_shift)},
+        smers_per_kmer{std::move(it.smers_per_kmer)},
         fwd_min_smer_value{std::move(it.fwd_min_smer_value)},
         rc_min_smer_value{std::move(it.rc_min_smer_value)},
         fwd_kmer_value{std::move(it.fwd_kmer_value)},
         rc_kmer_value{std::move(it.rc_kmer_value)},
-        fwd_smer_position{std::move(it.fwd_smer_position)},
-        rc_smer_position{std::move(it.rc_smer_position)},
+        fwd_smer_value{std::move(it.fwd_smer_value)},
+        rc_smer_value{std::move(it.rc_smer_value)},
+        syncmer_value{std::move(it.syncmer_value)},
+        smer_count{std::move(it.smer_count)},
+        fwd_min_smer_index{std::move(it.fwd_min_smer_index)},
+        rc_min_smer_index{std::move(it.rc_min_smer_index)},
         fwd_smer_values{std::move(it.fwd_smer_values)},
         rc_smer_values{std::move(it.rc_smer_values)}
     {}
@@ -149,7 +202,8 @@ public:
         fwd_kmer_mask{(1ULL << (2 * params.kmer_size)) - 1u}, // k = 32?
         fwd_smer_mask{(1ULL << (2 * params.smer_size)) - 1u},
         rc_kmer_shift{2 * (params.kmer_size - 1u)},
-        rc_smer_shift{2 * (params.smer_size - 1u)}
+        rc_smer_shift{2 * (params.smer_size - 1u)},
+        smers_per_kmer{params.kmer_size - params.smer_size + 1u}
     {
         init();
     }
@@ -213,7 +267,19 @@ public:
     }
 
 private:
-    template <bool with_pop = true>
+    // Position of the minimal forward s-mer within the current k-mer.
+    size_t fwd_smer_position() const noexcept
+    {
+        return fwd_min_smer_index - (smer_count - smers_per_kmer);
+    }
+
+    // Position of the minimal s-mer within the reverse complement of the current k-mer.
+    size_t rc_smer_position() const noexcept
+    {
+        return smer_count - 1u - rc_min_smer_index;
+    }
+
+    template <bool store_smer = true>
     void update_values()
     {
         value_type const new_rank = to_rank(*text_it);
@@ -222,25 +288,22 @@ private:
         fwd_kmer_value |= new_rank;
         fwd_kmer_value &= fwd_kmer_mask;
 
-        value_type new_fwd_smer_value{fwd_smer_values.back()};
-        new_fwd_smer_value <<= 2;
-        new_fwd_smer_value |= new_rank;
-        new_fwd_smer_value &= fwd_smer_mask;
-
-        if constexpr (with_pop)
-            fwd_smer_values.pop_front();
-        fwd_smer_values.push_back(new_fwd_smer_value);
+        fwd_smer_value <<= 2;
+        fwd_smer_value |= new_rank;
+        fwd_smer_value &= fwd_smer_mask;
 
         rc_kmer_value >>= 2;
         rc_kmer_value |= (new_rank ^ 3u) << rc_kmer_shift;
 
-        value_type new_rc_smer_value{rc_smer_values.front()};
-        new_rc_smer_value >>= 2;
-        new_rc_smer_value |= (new_rank ^ 3u) << rc_smer_shift;
+        rc_smer_value >>= 2;
+        rc_smer_value |= (new_rank ^ 3u) << rc_smer_shift;
 
-        if constexpr (with_pop)
-            rc_smer_values.pop_back();
-        rc_smer_values.push_front(new_rc_smer_value);
+        if constexpr (store_smer)
+        {
+            fwd_smer_values.set(smer_count, fwd_smer_value);
+            rc_smer_values.set(smer_count, rc_smer_value);
+            ++smer_count;
+        }
     }
 
     void next_unique_syncmer()
@@ -251,53 +314,44 @@ private:
 
     void find_minimum_fwd_smer()
     {
-        auto fwd_smer_it = std::ranges::min_element(fwd_smer_values, std::less_equal<value_type>{});
-        fwd_min_smer_value = *fwd_smer_it;
-        fwd_smer_position = std::distance(std::begin(fwd_smer_values), fwd_smer_it);
+        fwd_smer_values.find_minimum(smer_count - smers_per_kmer,
+                                     smer_count - 1u,
+                                     fwd_min_smer_value,
+                                     fwd_min_smer_index);
     }
 
     void find_minimum_rc_smer()
     {
-        auto rc_smer_it = std::ranges::min_element(rc_smer_values, std::less_equal<value_type>{});
-        rc_min_smer_value = *rc_smer_it;
-        rc_smer_position = std::distance(std::begin(rc_smer_values), rc_smer_it);
+        rc_smer_values.find_minimum(smer_count - smers_per_kmer, smer_count - 1u, rc_min_smer_value, rc_min_smer_index);
     }
 
     void init()
     {
-        // Initial values for update_values()
-        fwd_smer_values.push_back(value_type{});
-        rc_smer_values.push_front(value_type{});
-
-        // Don't keep smer values in queue while processing the first s-1 chracters.
+        // The first s-1 characters do not form an s-mer yet.
         for (size_t i = 0u; i < params.smer_size - 1; ++i)
         {
-            update_values();
+            update_values<false>();
             ++text_it;
         }
         // Fill queue with smer values.
         for (size_t i = params.smer_size - 1; i < params.kmer_size - 1u; ++i)
         {
-            update_values<false>();
+            update_values();
             ++text_it;
         }
-        update_values<false>();
-
-        // Remove initial values for update_values()
-        fwd_smer_values.pop_front();
-        rc_smer_values.pop_back();
+        update_values();
 
         find_minimum_fwd_smer();
         find_minimum_rc_smer();
 
         if (fwd_kmer_value <= rc_kmer_value)
         {
-            if (params.offset != fwd_smer_position)
+            if (params.offset != fwd_smer_position())
                 next_unique_syncmer();
             else
                 syncmer_value = fwd_kmer_value;
         }
-        else if (params.offset != rc_smer_position)
+        else if (params.offset != rc_smer_position())
             next_unique_syncmer();
         else
             syncmer_value = rc_kmer_value;
@@ -310,45 +364,41 @@ private:
         if (text_it == text_end)
             return true;
 
+        // Positions refer to the previous k-mer.
+        bool const fwd_min_leaves = fwd_smer_position() == 0;
+        bool const rc_min_is_first = rc_smer_position() == 0;
+
         update_values();
 
-        if (fwd_smer_position == 0)
+        if (fwd_min_leaves)
         {
             find_minimum_fwd_smer();
         }
-        else if (fwd_smer_values.back() < fwd_min_smer_value)
-        {
-            fwd_min_smer_value = fwd_smer_values.back();
-            fwd_smer_position = fwd_smer_values.size() - 1u;
-        }
-        else
+        else if (fwd_smer_value < fwd_min_smer_value)
         {
-            --fwd_smer_position;
+            fwd_min_smer_value = fwd_smer_value;
+            fwd_min_smer_index = smer_count - 1u;
         }
 
-        if (rc_smer_position == 0)
+        if (rc_min_is_first)
         {
             find_minimum_rc_smer();
         }
-        else if (rc_smer_values.front() < rc_min_smer_value)
-        {
-            rc_min_smer_value = rc_smer_values.front();
-            rc_smer_position = 0;
-        }
-        else
+        else if (rc_smer_value < rc_min_smer_value)
         {
-            ++rc_smer_position;
+            rc_min_smer_value = rc_smer_value;
+            rc_min_smer_index = smer_count - 1u;
         }
 
         if (fwd_kmer_value <= rc_kmer_value)
         {
-            if (params.offset == fwd_smer_position)
+            if (params.offset == fwd_smer_position())
             {
                 syncmer_value = fwd_kmer_value;
                 return true;
             }
         }
-        else if (params.offset == rc_smer_position)
+        else if (params.offset == rc_smer_position())
         {
             syncmer_value = rc_kmer_value;
             return true;
@@ -374,6 +424,8 @@ struct syncmer_fn
         static_assert(std::same_as<std::ranges::range_value_t<urng_t>, seqan3::dna4>, "Only dna4 supported.");
         if (params.kmer_size == 0u)
             throw std::invalid_argument{"kmer_size must be > 0."};
+        if (params.kmer_size > 32u)
+            throw std::invalid_argument{"kmer_size must be <= 32."};
         if (params.smer_size == 0u)
             throw std::invalid_argument{"smer_size must be > 0."};
         if (params.kmer_size < params.smer_size)
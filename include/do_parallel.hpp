@@ -0,0 +1,31 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#pragma once
+
+#include <algorithm>
+#include <future>
+#include <vector>
+
+// Splits [0, number_of_records) into `threads` contiguous parts and calls `worker(start, extent)` for each part on its
+// own thread. Returns after all workers finished; exceptions thrown by a worker are rethrown.
+template <typename worker_t>
+void do_parallel(worker_t && worker, size_t const number_of_records, size_t const threads)
+{
+    size_t const number_of_tasks = std::clamp<size_t>(threads, 1u, std::max<size_t>(number_of_records, 1u));
+    size_t const records_per_task = number_of_records / number_of_tasks;
+
+    std::vector<std::future<void>> tasks;
+    tasks.reserve(number_of_tasks);
+
+    for (size_t i = 0; i < number_of_tasks; ++i)
+    {
+        size_t const start = records_per_task * i;
+        size_t const extent = (i + 1u == number_of_tasks) ? number_of_records - start : records_per_task;
+        tasks.emplace_back(std::async(std::launch::async, worker, start, extent));
+    }
+
+    for (auto && task : tasks)
+        task.get();
+}
@@ -0,0 +1,19 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#pragma once
+
+#include <filesystem>
+#include <vector>
+
+#include "configuration.hpp"
+#include "hashing.hpp"
+
+// Writes the sorted and deduplicated hashes of each user bin to a .hashes file, and a file list for `build`.
+void hash_user_bins(configuration const & config);
+
+// Replaces `hashes` with the sorted and deduplicated hashes of the sequence file at `path`.
+void hash_user_bin(std::filesystem::path const & path,
+                   hash_parameters const & parameters,
+                   std::vector<uint64_t> & hashes);
@@ -0,0 +1,61 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#pragma once
+
+#include <array>
+#include <filesystem>
+#include <span>
+#include <string>
+
+#include "hashing.hpp"
+#include "mapped_file.hpp"
+
+/* A .hashes file stores the sorted and deduplicated hashes of one user bin:
+ *   magic (8 bytes) | version (uint32_t) | k, w, s, t, hash type (uint8_t each) | 7 bytes padding |
+ *   number of hashes (uint64_t) | hashes (uint64_t each)
+ * The hashes start at an 8-byte aligned offset, such that they can be used directly from a memory mapping.
+ */
+
+inline constexpr std::string_view hash_file_extension{".hashes"};
+
+//!\brief Identifies the hash function, e.g. "minimiser_k20_w24" or "syncmer_k15_s11_t2".
+std::string hash_parameters_key(hash_parameters const & parameters);
+
+//!\brief Whether `path` is a .hashes file, judging by its extension.
+bool is_hash_file(std::filesystem::path const & path);
+
+void write_hash_file(std::filesystem::path const & path,
+                     hash_parameters const & parameters,
+                     std::span<uint64_t const> const hashes);
+
+//!\brief A memory-mapped .hashes file.
+class hash_file
+{
+public:
+    hash_file() = delete;
+    hash_file(hash_file const &) = delete;
+    hash_file & operator=(hash_file const &) = delete;
+    hash_file(hash_file &&) = delete;
+    hash_file & operator=(hash_file &&) = delete;
+    ~hash_file() = default;
+
+    //!\brief Throws if `path` is not a .hashes file.
+    explicit hash_file(std::filesystem::path const & path);
+
+    hash_parameters const & parameters() const noexcept
+    {
+        return file_parameters;
+    }
+
+    std::span<uint64_t const> hashes() const noexcept
+    {
+        return file_hashes;
+    }
+
+private:
+    mapped_file file;
+    hash_parameters file_parameters{};
+    std::span<uint64_t const> file_hashes{};
+};
@@ -0,0 +1,21 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#pragma once
+
+#include <sharg/all.hpp>
+
+#include "configuration.hpp"
+
+// The hash options shared by the `build` and `hash` subcommands.
+
+void add_minimiser_options(sharg::parser & parser, configuration & config);
+
+// Call after parsing. Defaults the window size to the k-mer size and throws if the window is too small.
+void check_minimiser_options(sharg::parser & parser, configuration & config);
+
+void add_syncmer_options(sharg::parser & parser, configuration & config);
+
+// Call after parsing. Throws if s or t do not fit into the k-mer.
+void check_syncmer_options(configuration const & config);
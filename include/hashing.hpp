@@ -0,0 +1,37 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+
+#include "configuration.hpp"
+
+struct hash_parameters
+{
+    hash_type hash{hash_type::invalid};
+    uint8_t kmer_size{};
+    uint8_t window_size{};
+    uint8_t s{};
+    uint8_t t{};
+};
+
+// The kernels below clear `hashes` and fill it with the hashes of `sequence`. They produce the same values as
+// `seqan3::views::minimiser_hash` and `seqan3::views::syncmer`, but work on contiguous memory in a single loop.
+
+void minimiser_hashes(std::span<seqan3::dna4 const> const sequence,
+                      hash_parameters const & parameters,
+                      std::vector<uint64_t> & hashes);
+
+void syncmer_hashes(std::span<seqan3::dna4 const> const sequence,
+                    hash_parameters const & parameters,
+                    std::vector<uint64_t> & hashes);
+
+// Dispatches to the kernel for `parameters.hash`.
+void compute_hashes(std::span<seqan3::dna4 const> const sequence,
+                    hash_parameters const & parameters,
+                    std::vector<uint64_t> & hashes);
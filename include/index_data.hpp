@@ -4,7 +4,18 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+#include "block_compression.hpp"
 #include "configuration.hpp"
+#include "index_header.hpp"
+#include "mapped_file.hpp"
+#include "syncmer_threshold.hpp"
 #include <cereal/archives/binary.hpp>
 #include <hibf/config.hpp>
 #include <hibf/hierarchical_interleaved_bloom_filter.hpp>
@@ -18,6 +29,8 @@ public:
     uint8_t t{};
     hash_type hash{};
     seqan::hibf::hierarchical_interleaved_bloom_filter hibf{};
+    syncmer_threshold syncmer_model{}; // Empty for k-mer and minimiser indexes.
+    std::vector<uint64_t> removed_user_bins{}; // Sorted. Removed by `update`; never reported by `search`.
 
     myindex() = default;
     myindex & operator=(myindex const &) = default;
@@ -33,20 +46,128 @@ public:
         t{config.t},
         hash{config.hash},
         hibf{std::move(index)}
-    {}
+    {
+        if (hash == hash_type::syncmer)
+            syncmer_model = syncmer_threshold{kmer_size, s};
+    }
+
+    bool is_removed(uint64_t const user_bin_id) const noexcept
+    {
+        return std::ranges::binary_search(removed_user_bins, user_bin_id);
+    }
 
-    void store(std::filesystem::path const & path) const
+    //!\brief Describes this index. The checksum is only known after writing the payload and left zero.
+    index_header header() const
     {
-        std::ofstream fout{path};
+        index_header result{.kmer_size = kmer_size,
+                            .window_size = window_size,
+                            .s = s,
+                            .t = t,
+                            .hash = hash,
+                            .number_of_user_bins = hibf.number_of_user_bins};
+
+        if (hibf.ibf_vector.empty())
+            return result;
+
+        // Breadth-first traversal from the root IBF. Merged bins point to an IBF on the next level, all other bins
+        // point to their own IBF.
+        std::vector<size_t> levels(hibf.ibf_vector.size());
+        std::vector<bool> visited(hibf.ibf_vector.size());
+        std::vector<size_t> queue{0u};
+        visited[0] = true;
+
+        for (size_t i = 0; i < queue.size(); ++i)
+        {
+            size_t const ibf_id = queue[i];
+            size_t const level = levels[ibf_id];
+
+            result.number_of_levels = std::max<size_t>(result.number_of_levels, level + 1u);
+            result.bytes_per_level[std::min(level, index_header::max_levels - 1u)] +=
+                hibf.ibf_vector[ibf_id].bit_size() / 8u;
+
+            for (auto const next_ibf_id : hibf.next_ibf_id[ibf_id])
+            {
+                size_t const child = static_cast<size_t>(next_ibf_id);
+                if (visited[child])
+                    continue;
+
+                visited[child] = true;
+                levels[child] = level + 1u;
+                queue.push_back(child);
+            }
+        }
+
+        return result;
+    }
+
+    //!\brief Stores the index. A compressed index is compressed with `threads` threads.
+    void store(std::filesystem::path const & path, bool const compress = false, size_t const threads = 1u) const
+    {
+        if (compress)
+            check_block_compression_available();
+
+        index_header header = this->header();
+        header.compression = compress ? payload_compression::zlib_blocks : payload_compression::none;
+
+        std::ofstream fout{path, std::ios::binary};
         cereal::BinaryOutputArchive oarchive{fout};
-        oarchive(*this);
+        oarchive(header);
+        std::streamoff const padding = header.payload_offset - static_cast<std::streamoff>(fout.tellp());
+        std::fill_n(std::ostreambuf_iterator<char>{fout}, padding, '\0');
+
+        // The payload is checksummed while it is written; only the header is written twice.
+        {
+            checksumming_buffer checksummed{*fout.rdbuf()};
+            std::ostream payload_stream{&checksummed};
+
+            if (compress)
+            {
+                block_compressing_buffer buffer{payload_stream, threads};
+                {
+                    std::ostream compressed_stream{&buffer};
+                    cereal::BinaryOutputArchive compressed_archive{compressed_stream};
+                    compressed_archive(*this);
+                }
+                buffer.finish();
+            }
+            else
+            {
+                cereal::BinaryOutputArchive payload_archive{payload_stream};
+                payload_archive(*this);
+            }
+
+            header.checksum = checksummed.checksum();
+        }
+
+        fout.seekp(0);
+        oarchive(header);
+        if (!fout.good())
+            throw std::runtime_error{"Could not write " + path.string() + '.'};
     }
 
-    void load(std::filesystem::path const & path)
+    // Deserialises the index directly from a read-only mapping of the file, without a stream buffer in between. The
+    // HIBF is still copied onto the heap, so loading takes time proportional to the size of the index. A compressed
+    // index is decompressed with `threads` threads. The checksum is not verified.
+    void load(std::filesystem::path const & path, size_t const threads = 1u)
     {
-        std::ifstream fin{path};
-        cereal::BinaryInputArchive iarchive{fin};
-        iarchive(*this);
+        mapped_file const file{path};
+        span_buffer mapped{file.data()};
+        std::istream stream{&mapped};
+        index_header const header = index_header::read(stream, path);
+
+        if (header.compression == payload_compression::zlib_blocks)
+        {
+            block_decompressing_buffer decompressing{file.data().subspan(header.payload_offset), threads};
+            std::istream decompressed_stream{&decompressing};
+            cereal::BinaryInputArchive iarchive{decompressed_stream};
+            iarchive(*this);
+        }
+        else
+        {
+            stream.seekg(header.payload_offset);
+            cereal::BinaryInputArchive iarchive{stream};
+            iarchive(*this);
+        }
     }
 
     template <typename archive_t>
@@ -58,5 +179,7 @@ public:
         archive(t);
         archive(hash);
         archive(hibf);
+        archive(syncmer_model);
+        archive(removed_user_bins);
     }
 };
@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <istream>
+#include <span>
+#include <streambuf>
+#include <vector>
+
+#include "configuration.hpp"
+#include <cereal/types/array.hpp>
+
+enum class payload_compression : uint8_t
+{
+    none,
+    zlib_blocks // See block_compression.hpp.
+};
+
+/*!\brief The fixed-size header at the front of an index file.
+ * \details
+ * The header describes the index without deserialising the HIBF. It is followed by zero padding up to
+ * `payload_offset`, where the serialised myindex starts. The offset is a multiple of `alignment`, such that the
+ * payload starts at an aligned address when the file is memory-mapped.
+ */
+struct index_header
+{
+    static constexpr std::array<char, 8> expected_magic{'H', 'I', 'B', 'F', 'H', 'A', 'S', 'H'};
+    static constexpr uint32_t current_version{2u};
+    static constexpr uint32_t alignment{64u};
+    //!\brief The number of levels the header has room for. Deeper levels are added to the last entry.
+    static constexpr size_t max_levels{8u};
+
+    std::array<char, 8> magic{expected_magic};
+    uint32_t version{current_version};
+    uint32_t payload_offset{2u * alignment}; // The smallest multiple of `alignment` that fits the header.
+    uint8_t kmer_size{};
+    uint8_t window_size{};
+    uint8_t s{};
+    uint8_t t{};
+    hash_type hash{};
+    uint8_t number_of_levels{};
+    payload_compression compression{payload_compression::none};
+    uint8_t reserved{};
+    uint64_t number_of_user_bins{};
+    uint64_t checksum{}; // FNV-1a of the payload as stored, i.e. compressed if the index is compressed.
+    std::array<uint64_t, max_levels> bytes_per_level{};
+
+    //!\brief Reads and validates a header. Throws if `stream` does not start with an index of the current version.
+    static index_header read(std::istream & stream, std::filesystem::path const & path);
+    static index_header read(std::filesystem::path const & path);
+
+    static constexpr uint64_t checksum_seed{0xcbf29ce484222325ULL};
+
+    //!\brief The 64 bit FNV-1a hash of `data`. Pass the hash of the preceding data as `hash` to continue it.
+    static uint64_t compute_checksum(std::span<char const> const data, uint64_t const hash = checksum_seed) noexcept;
+
+    template <typename archive_t>
+    void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
+    {
+        archive(magic);
+        archive(version);
+        archive(payload_offset);
+        archive(kmer_size);
+        archive(window_size);
+        archive(s);
+        archive(t);
+        archive(hash);
+        archive(number_of_levels);
+        archive(compression);
+        archive(reserved);
+        archive(number_of_user_bins);
+        archive(checksum);
+        archive(bytes_per_level);
+    }
+};
+
+//!\brief Passes everything written to it on to `target` and computes the index_header checksum along the way.
+class checksumming_buffer : public std::streambuf
+{
+public:
+    checksumming_buffer() = delete;
+    checksumming_buffer(checksumming_buffer const &) = delete;
+    checksumming_buffer & operator=(checksumming_buffer const &) = delete;
+    checksumming_buffer(checksumming_buffer &&) = delete;
+    checksumming_buffer & operator=(checksumming_buffer &&) = delete;
+    ~checksumming_buffer() override;
+
+    explicit checksumming_buffer(std::streambuf & target);
+
+    //!\brief The checksum of all data written so far. Writes the buffered data to `target`.
+    uint64_t checksum();
+
+protected:
+    int_type overflow(int_type const character) override;
+    int sync() override;
+
+private:
+    std::streambuf & target;
+    std::vector<char> buffer;
+    uint64_t hash{index_header::checksum_seed};
+};
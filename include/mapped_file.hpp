@@ -0,0 +1,110 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#pragma once
+
+#include <filesystem>
+#include <ios>
+#include <span>
+#include <stdexcept>
+#include <streambuf>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// A read-only memory mapping of a whole file. The pages come from the page cache, so a file that was read recently
+// is not read from disk again.
+class mapped_file
+{
+public:
+    mapped_file() = delete;
+    mapped_file(mapped_file const &) = delete;
+    mapped_file & operator=(mapped_file const &) = delete;
+    mapped_file(mapped_file &&) = delete;
+    mapped_file & operator=(mapped_file &&) = delete;
+
+    explicit mapped_file(std::filesystem::path const & path)
+    {
+        int const file_descriptor = ::open(path.c_str(), O_RDONLY);
+        if (file_descriptor == -1)
+            throw std::runtime_error{"Could not open " + path.string() + '.'};
+
+        struct stat status{};
+        if (::fstat(file_descriptor, &status) != 0)
+        {
+            ::close(file_descriptor);
+            throw std::runtime_error{"Could not determine the size of " + path.string() + '.'};
+        }
+        size = static_cast<size_t>(status.st_size);
+
+        if (size != 0u)
+            address = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, file_descriptor, 0);
+
+        ::close(file_descriptor);
+
+        if (address == MAP_FAILED)
+        {
+            size = 0u;
+            throw std::runtime_error{"Could not map " + path.string() + " into memory."};
+        }
+
+        // The file is read front to back.
+        if (size != 0u)
+            ::madvise(address, size, MADV_SEQUENTIAL);
+    }
+
+    ~mapped_file()
+    {
+        if (size != 0u)
+            ::munmap(address, size);
+    }
+
+    std::span<char const> data() const noexcept
+    {
+        return {static_cast<char const *>(address), size};
+    }
+
+private:
+    void * address{nullptr};
+    size_t size{};
+};
+
+// A read-only stream buffer over memory that is owned elsewhere, e.g. by a `mapped_file`.
+class span_buffer : public std::streambuf
+{
+public:
+    explicit span_buffer(std::span<char const> const data)
+    {
+        char * const begin = const_cast<char *>(data.data());
+        setg(begin, begin, begin + data.size());
+    }
+
+protected:
+    pos_type seekoff(off_type const offset,
+                     std::ios_base::seekdir const way,
+                     std::ios_base::openmode const mode) override
+    {
+        if (!(mode & std::ios_base::in))
+            return pos_type(off_type(-1));
+
+        off_type position = offset;
+        if (way == std::ios_base::cur)
+            position += gptr() - eback();
+        else if (way == std::ios_base::end)
+            position += egptr() - eback();
+
+        if (position < 0 || position > egptr() - eback())
+            return pos_type(off_type(-1));
+
+        setg(eback(), eback() + position, egptr());
+        return pos_type(position);
+    }
+
+    pos_type seekpos(pos_type const position, std::ios_base::openmode const mode) override
+    {
+        return seekoff(off_type(position), std::ios_base::beg, mode);
+    }
+};
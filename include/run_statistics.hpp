@@ -0,0 +1,114 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+//!\brief Summary of a per-item count, e.g. hashes per read.
+struct distribution
+{
+    uint64_t count{};
+    uint64_t sum{};
+    uint64_t min{std::numeric_limits<uint64_t>::max()};
+    uint64_t max{};
+
+    void add(uint64_t const value) noexcept
+    {
+        ++count;
+        sum += value;
+        min = std::min(min, value);
+        max = std::max(max, value);
+    }
+
+    void merge(distribution const & other) noexcept
+    {
+        count += other.count;
+        sum += other.sum;
+        min = std::min(min, other.min);
+        max = std::max(max, other.max);
+    }
+};
+
+//!\brief Splits the wall time of a loop body into phases. Cheap enough to call per record.
+class lap_clock
+{
+public:
+    //!\brief Returns the seconds since the previous lap (or construction).
+    double lap() noexcept
+    {
+        auto const now = std::chrono::steady_clock::now();
+        std::chrono::duration<double> const elapsed = now - last;
+        last = now;
+        return elapsed.count();
+    }
+
+private:
+    std::chrono::steady_clock::time_point last{std::chrono::steady_clock::now()};
+};
+
+/*!\brief The report of `--stats`: time per phase, counters, and peak RSS, written as JSON.
+ * Top-level phases run on the calling thread and record wall time and CPU time of the whole process.
+ * Thread phases are parts of parallel loops; their wall time is summed over all threads.
+ * All member functions are thread-safe.
+ */
+class run_statistics
+{
+public:
+    //!\brief Adds the wall and CPU time between construction and destruction to a top-level phase of `stats`.
+    //!\details Does nothing if `stats` is null.
+    class scoped_phase
+    {
+    public:
+        scoped_phase(run_statistics * stats, std::string name);
+        scoped_phase(scoped_phase const &) = delete;
+        scoped_phase & operator=(scoped_phase const &) = delete;
+        ~scoped_phase();
+
+    private:
+        run_statistics * stats;
+        std::string name;
+        std::chrono::steady_clock::time_point wall_start{};
+        double cpu_start{};
+    };
+
+    explicit run_statistics(std::string command) : command{std::move(command)}
+    {}
+
+    void add_phase(std::string const & name, double wall_seconds, double cpu_seconds);
+    void add_thread_phase(std::string const & name, double seconds);
+    void add_counter(std::string const & name, uint64_t value);
+    void add_distribution(std::string const & name, distribution const & values);
+    void set_list(std::string const & name, std::vector<uint64_t> values);
+
+    void write(std::filesystem::path const & path) const;
+
+    //!\brief CPU time of all threads of this process.
+    static double process_cpu_seconds() noexcept;
+    //!\brief The maximum resident set size of this process so far.
+    static uint64_t peak_rss_bytes() noexcept;
+
+private:
+    struct timing
+    {
+        double wall_seconds{};
+        double cpu_seconds{};
+    };
+
+    std::string command;
+    mutable std::mutex mutex;
+    std::map<std::string, timing> phases;
+    std::map<std::string, double> thread_phases;
+    std::map<std::string, uint64_t> counters;
+    std::map<std::string, distribution> distributions;
+    std::map<std::string, std::vector<uint64_t>> lists;
+};
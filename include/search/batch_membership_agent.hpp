@@ -0,0 +1,81 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include <hibf/hierarchical_interleaved_bloom_filter.hpp>
+
+/*!\brief Answers the membership queries of many reads at once.
+ * \details
+ * The HIBF's membership agent descends the tree for one read at a time, so consecutive lookups of a read go to
+ * different IBFs. This agent visits the IBFs in breadth-first order instead and counts all reads that reached an IBF
+ * before moving on to the next one. Consecutive lookups of different reads go to the same IBF, so the IBF's
+ * bookkeeping is set up once per batch and small IBFs stay in the cache; large IBFs still miss the cache per lookup.
+ * The results are the same as those of `membership_for`, sorted by user bin. The hash count of each reported user bin
+ * is kept, so a low threshold can serve as floor for several stricter thresholds.
+ * Not thread-safe; each thread uses its own agent.
+ */
+class batch_membership_agent
+{
+public:
+    batch_membership_agent() = delete;
+    batch_membership_agent(batch_membership_agent const &) = delete;
+    batch_membership_agent & operator=(batch_membership_agent const &) = delete;
+    batch_membership_agent(batch_membership_agent &&) = default;
+    batch_membership_agent & operator=(batch_membership_agent &&) = delete;
+    ~batch_membership_agent() = default;
+
+    explicit batch_membership_agent(seqan::hibf::hierarchical_interleaved_bloom_filter const & hibf);
+
+    //!\brief Removes all reads.
+    void clear();
+
+    //!\brief Adds a read with its hashes and the minimum number of hashes a user bin must contain.
+    void add(std::span<uint64_t const> const hashes, uint16_t const threshold);
+
+    //!\brief Queries all added reads.
+    void query();
+
+    //!\brief The user bins of the `read`-th added read. Valid until the next call to `clear`.
+    std::span<uint64_t const> result(size_t const read) const
+    {
+        return results[read];
+    }
+
+    //!\brief For each user bin of `result(read)`, how many hashes of the read it contains.
+    std::span<uint32_t const> counts(size_t const read) const
+    {
+        return result_counts[read];
+    }
+
+    //!\brief The number of hashes of the `read`-th added read.
+    size_t hash_count(size_t const read) const
+    {
+        return hash_offsets[read + 1u] - hash_offsets[read];
+    }
+
+    size_t size() const noexcept
+    {
+        return thresholds.size();
+    }
+
+private:
+    using counting_agent_t = seqan::hibf::interleaved_bloom_filter::counting_agent_type<uint16_t>;
+
+    seqan::hibf::hierarchical_interleaved_bloom_filter const * hibf{};
+    std::vector<size_t> ibf_order{};                   // Breadth-first; parents before children.
+    std::vector<std::optional<counting_agent_t>> agents{}; // Created when an IBF is first queried.
+
+    std::vector<uint64_t> hashes{}; // Of all reads, concatenated.
+    std::vector<size_t> hash_offsets{0u};
+    std::vector<uint16_t> thresholds{};
+    std::vector<std::vector<uint32_t>> pending{}; // The reads to query in each IBF.
+    std::vector<std::vector<uint64_t>> results{};
+    std::vector<std::vector<uint32_t>> result_counts{}; // Parallel to `results`.
+};
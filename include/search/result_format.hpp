@@ -0,0 +1,102 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include "configuration.hpp"
+#include "search/searcher.hpp"
+
+//!\brief Appends `value` in 7-bit groups, least significant first. The high bit marks that more groups follow.
+inline void append_varint(std::string & out, uint64_t value)
+{
+    while (value >= 0x80u)
+    {
+        out += static_cast<char>((value & 0x7Fu) | 0x80u);
+        value >>= 7;
+    }
+    out += static_cast<char>(value);
+}
+
+//!\brief Decodes a varint from the front of `data` and advances `data`. Returns false if `data` ends too early.
+inline bool read_varint(std::span<char const> & data, uint64_t & value)
+{
+    value = 0u;
+    for (size_t i = 0; i < data.size() && i < 10u; ++i)
+    {
+        uint64_t const byte = static_cast<uint8_t>(data[i]);
+        value |= (byte & 0x7Fu) << (7u * i);
+        if ((byte & 0x80u) == 0u)
+        {
+            data = data.subspan(i + 1u);
+            return true;
+        }
+    }
+    return false;
+}
+
+//!\brief The start of a binary result file. Records follow directly.
+struct binary_result_header
+{
+    static constexpr std::string_view magic{"HIBFRES"};
+    static constexpr uint8_t current_version{1u};
+    static constexpr uint8_t counts_flag{1u}; // The records are those of `search --counts`.
+
+    uint8_t version{current_version};
+    uint8_t flags{};
+};
+
+//!\brief Appends the magic, the version, and the flags, one byte each after the magic.
+inline void append_binary_header(std::string & out, binary_result_header const header)
+{
+    out += binary_result_header::magic;
+    out += static_cast<char>(header.version);
+    out += static_cast<char>(header.flags);
+}
+
+//!\brief Decodes the header from the front of `data` and advances `data`. Returns false if there is no header.
+inline bool read_binary_header(std::span<char const> & data, binary_result_header & header)
+{
+    std::string_view const magic = binary_result_header::magic;
+    if (data.size() < magic.size() + 2u || std::string_view{data.data(), magic.size()} != magic)
+        return false;
+
+    header.version = static_cast<uint8_t>(data[magic.size()]);
+    header.flags = static_cast<uint8_t>(data[magic.size() + 1u]);
+    data = data.subspan(magic.size() + 2u);
+    return true;
+}
+
+/*!\brief Appends the result of one read to `out`.
+ * \details
+ * * text: `id: [0,1,2]`, one line per read.
+ * * tsv: `id<TAB>user bin`, one line per hit. Reads without hits have no line.
+ * * binary: read index, number of user bins, and the user bins, each as varint. Read indices count from 0 in input
+ *   order. A file starts with a `binary_result_header`.
+ */
+void append_result(std::string & out,
+                   result_format const format,
+                   std::string_view const id,
+                   uint64_t const read_index,
+                   std::span<uint64_t const> const user_bins);
+
+/*!\brief Appends the hash counts of one read (`search --counts`) to `out`.
+ * \details
+ * The thresholds are those for 0 to `--error` errors; see `count_result`.
+ * * text: `id: 41 hashes, thresholds [41,29], counts [0:41,3:12]`, i.e., the read's number of hashes, its thresholds,
+ *   and `user bin:count` pairs.
+ * * tsv: `id<TAB>user bin<TAB>count<TAB>number of hashes<TAB>thresholds`, one line per user bin. The thresholds are
+ *   separated by commas.
+ * * binary: read index, number of hashes, number of thresholds, the thresholds, number of user bins, and a user bin
+ *   and its count per user bin; each as varint.
+ */
+void append_count_result(std::string & out,
+                         result_format const format,
+                         std::string_view const id,
+                         uint64_t const read_index,
+                         count_result const & result);
@@ -0,0 +1,89 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#pragma once
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+// Collects results in a fixed-size buffer and hands it to the output (and optionally stdout) whenever it is full.
+// Memory use does not depend on the number of results. The output is either a file or a stream owned by the caller.
+class result_writer
+{
+public:
+    result_writer() = delete;
+    result_writer(result_writer const &) = delete;
+    result_writer & operator=(result_writer const &) = delete;
+    result_writer(result_writer &&) = delete;
+    result_writer & operator=(result_writer &&) = delete;
+
+    explicit result_writer(std::filesystem::path const & path, bool const echo) :
+        file{path, std::ios::binary},
+        out{&file},
+        echo{echo}
+    {
+        if (!file.good())
+            throw std::runtime_error{"Could not open " + path.string() + " for writing."};
+
+        start();
+    }
+
+    explicit result_writer(std::ostream & stream, bool const echo) : out{&stream}, echo{echo}
+    {
+        start();
+    }
+
+    // Call `flush()` before destruction to learn about write errors; a destructor must not throw.
+    ~result_writer()
+    {
+        try
+        {
+            flush();
+        }
+        catch (std::runtime_error const &)
+        {}
+    }
+
+    void write(std::string_view const line)
+    {
+        if (buffer.size() + line.size() > buffer_capacity)
+            flush();
+        buffer += line;
+    }
+
+    //!\brief Writes the buffer to the output. Throws if the output or the standard output failed.
+    void flush()
+    {
+        out->write(buffer.data(), buffer.size());
+        out->flush();
+        if (echo)
+            std::cout.write(buffer.data(), buffer.size());
+        buffer.clear();
+
+        if (!out->good())
+            throw std::runtime_error{"Could not write the results."};
+        if (echo && !std::cout.good())
+            throw std::runtime_error{"Could not print the results."};
+    }
+
+private:
+    static constexpr size_t buffer_capacity{1ULL << 20};
+
+    void start()
+    {
+        buffer.reserve(buffer_capacity);
+
+        if (echo)
+            std::cout << "The following hits were found:\n";
+    }
+
+    std::ofstream file{};
+    std::ostream * out{};
+    bool echo{};
+    std::string buffer{};
+};
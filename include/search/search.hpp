@@ -4,6 +4,31 @@
 
 #pragma once
 
+#include <seqan3/io/sequence_file/all.hpp>
+
 #include "configuration.hpp"
+#include "dna4_traits.hpp"
+#include "run_statistics.hpp"
+#include "search/result_writer.hpp"
+#include "search/searcher.hpp"
+
+using reads_file_t = seqan3::sequence_file_input<dna4_traits, seqan3::fields<seqan3::field::id, seqan3::field::seq>>;
+
+// Searches the reads of `config.reads` (a file, a named pipe, or `-` for standard input) and writes the results to
+// `config.search_output`. A wrapper around `searcher`.
+void search(configuration const & config);
+
+// Reads FASTA or FASTQ records from a stream without a file name, e.g., standard input. The first character decides
+// the format. The stream is read once, front to back.
+reads_file_t open_reads(std::istream & stream);
 
-void search(configuration const & config);
\ No newline at end of file
+// Writes the result of each record of `reads` in `format` to `writer`, in input order, and returns the number of
+// records. With `counts`, the results are hash counts per user bin (see `searcher::count`). Used by `search` and
+// `serve`.
+size_t search_reads(searcher const & index_searcher,
+                    reads_file_t & reads,
+                    result_writer & writer,
+                    result_format const format,
+                    bool const counts,
+                    size_t const threads,
+                    run_statistics * const stats_report = nullptr);
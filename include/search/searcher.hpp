@@ -0,0 +1,112 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+
+#include "configuration.hpp"
+#include "hashing.hpp"
+#include "index_data.hpp"
+#include "run_statistics.hpp"
+#include "search/batch_membership_agent.hpp"
+#include "search/thresholder.hpp"
+
+/*!\brief The hash counts of one query. `counts[i]` is the number of the query's hashes in `user_bins[i]`.
+ * \details
+ * `thresholds[e]` is the minimum count for `e` errors, for `e` from 0 to `config.error`. A user bin is reported for `e`
+ * errors if its count reaches `thresholds[e]`.
+ */
+struct count_result
+{
+    uint64_t hash_count{}; // The number of hashes of the query.
+    std::vector<uint64_t> thresholds{};
+    std::vector<uint64_t> user_bins{};
+    std::vector<uint32_t> counts{};
+};
+
+/*!\brief Searches sequences in an HIBF index, without reading or writing files.
+ * \details
+ * The index and the threshold model are set up once. `config.error` and `config.threshold_cache` apply to all
+ * queries. Results are sorted user bin IDs; removed user bins are never reported.
+ * All member functions are thread-safe. Concurrent queries share the index and the thresholds; membership agents are
+ * kept in a pool and reused.
+ */
+class searcher
+{
+public:
+    searcher() = delete;
+    searcher(searcher const &) = delete;
+    searcher & operator=(searcher const &) = delete;
+    searcher(searcher &&) = delete;
+    searcher & operator=(searcher &&) = delete;
+    ~searcher() = default;
+
+    //!\brief Loads `config.index_file` with `config.threads` threads.
+    explicit searcher(configuration const & config);
+
+    //!\brief Takes an index that is already loaded.
+    explicit searcher(myindex index, configuration const & config);
+
+    //!\brief The user bins containing `sequence`.
+    std::vector<uint64_t> query(std::span<seqan3::dna4 const> const sequence) const;
+
+    /*!\brief Queries all `sequences` together, which is faster than querying them one by one.
+     * \details
+     * `results[i]` are the user bins containing `sequences[i]`. The memory of `results` is reused.
+     * If `stats` is set, hashing and membership queries are timed, and bases and hashes are counted.
+     */
+    void query_batch(std::span<std::span<seqan3::dna4 const> const> const sequences,
+                     std::vector<std::vector<uint64_t>> & results,
+                     run_statistics * const stats = nullptr) const;
+
+    /*!\brief Counts the hashes of `sequence` in each user bin that has at least as many as the threshold.
+     * \details
+     * Set `config.error` to the largest number of errors of interest. The counts then contain every user bin that is
+     * reported for this or any smaller number of errors, so all of them can be decided from a single pass.
+     */
+    count_result count(std::span<seqan3::dna4 const> const sequence) const;
+
+    //!\brief Like `count`, for all `sequences` together. The memory of `results` is reused.
+    void count_batch(std::span<std::span<seqan3::dna4 const> const> const sequences,
+                     std::vector<count_result> & results,
+                     run_statistics * const stats = nullptr) const;
+
+    myindex const & index() const noexcept
+    {
+        return hibf_index;
+    }
+
+private:
+    struct workspace
+    {
+        explicit workspace(myindex const & index) : agent{index.hibf}
+        {}
+
+        batch_membership_agent agent;
+        std::vector<uint64_t> hashes{};
+    };
+
+    // Hashes and queries all `sequences`, then calls `collect(agent)` to read the results.
+    template <typename collect_t>
+    void search_batch(std::span<std::span<seqan3::dna4 const> const> const sequences,
+                      run_statistics * const stats,
+                      collect_t && collect) const;
+
+    std::unique_ptr<workspace> acquire() const;
+    void release(std::unique_ptr<workspace> space) const;
+
+    myindex hibf_index;
+    thresholder thresholds;
+    std::vector<std::unique_ptr<thresholder>> level_thresholds{}; // For 0 to `config.error - 1` errors.
+    hash_parameters parameters{};
+
+    mutable std::mutex pool_mutex{};
+    mutable std::vector<std::unique_ptr<workspace>> pool{};
+};
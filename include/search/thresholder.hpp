@@ -0,0 +1,52 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#pragma once
+
+#include <future>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include "configuration.hpp"
+#include "index_data.hpp"
+#include <threshold/threshold.hpp>
+
+/*!\brief Provides the minimum number of hits for a read, depending on its length.
+ * \details
+ * Syncmer indexes use the model stored in the index. For k-mer and minimiser indexes, a threshold::threshold is
+ * computed the first time a read length is seen, and reused afterwards. Lengths above 256 share a threshold within
+ * buckets of less than 1% of the length (see `length_bucket`), which bounds the number of thresholds.
+ * get() is thread-safe. A threshold is computed without holding the lock; threads that need the same one wait for it.
+ */
+class thresholder
+{
+public:
+    thresholder() = delete;
+    thresholder(thresholder const &) = delete;
+    thresholder & operator=(thresholder const &) = delete;
+    thresholder(thresholder &&) = delete;
+    thresholder & operator=(thresholder &&) = delete;
+    ~thresholder() = default;
+
+    thresholder(configuration const & config, myindex const & index);
+
+    //!\brief The minimum number of hashes a user bin must contain. At least 1.
+    size_t get(size_t const query_length, size_t const hash_count) const;
+
+    //!\brief The length whose threshold is used for `query_length`. Rounds down, which never raises the threshold.
+    static size_t length_bucket(size_t const query_length) noexcept;
+
+private:
+    threshold::threshold const & threshold_for(size_t const query_length) const;
+
+    uint8_t kmer_size{};
+    uint8_t window_size{};
+    uint8_t errors{};
+    std::filesystem::path threshold_cache{};
+    syncmer_threshold const * syncmer_model{}; // Only set for syncmer indexes.
+
+    mutable std::shared_mutex mutex{};
+    // Keyed by `length_bucket`. Entries are never removed, so references to the thresholds stay valid.
+    mutable std::unordered_map<size_t, std::shared_future<threshold::threshold>> thresholds{};
+};
@@ -0,0 +1,89 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+/*!\brief The messages exchanged between `client` and `serve`.
+ * \details
+ * Each message is a frame of a one-byte type, the payload size as 64-bit little-endian integer, and the payload.
+ * A client sends `search` with FASTA or FASTQ records and receives `result` with one result line per record, or
+ * `error` with a message. `shutdown` stops the server, which answers with an empty `result`.
+ */
+enum class message_type : uint8_t
+{
+    search = 1,
+    shutdown = 2,
+    result = 3,
+    error = 4
+};
+
+struct message
+{
+    message_type type{};
+    std::string payload{};
+};
+
+// Owns the file descriptor of a Unix domain socket.
+class unix_socket
+{
+public:
+    unix_socket() = default;
+    unix_socket(unix_socket const &) = delete;
+    unix_socket & operator=(unix_socket const &) = delete;
+    unix_socket(unix_socket && other) noexcept;
+    unix_socket & operator=(unix_socket && other) noexcept;
+    ~unix_socket();
+
+    explicit unix_socket(int const fd) : fd{fd}
+    {}
+
+    // Binds to `path` and listens without blocking. A stale socket file at `path` is replaced.
+    static unix_socket listen(std::filesystem::path const & path);
+    static unix_socket connect(std::filesystem::path const & path);
+    // Two connected sockets.
+    static std::pair<unix_socket, unix_socket> pair();
+
+    // Returns an invalid socket if no connection is waiting. The returned socket blocks.
+    unix_socket accept() const;
+
+    // Receiving fails with `receive_timeout` if the peer sends nothing for `seconds`. 0 means no timeout.
+    void set_receive_timeout(uint32_t const seconds) const;
+
+    int get() const noexcept
+    {
+        return fd;
+    }
+
+    bool valid() const noexcept
+    {
+        return fd != -1;
+    }
+
+private:
+    int fd{-1};
+};
+
+// Thrown by `read_message` if a frame announces more than the allowed payload. The payload is not read.
+struct message_too_large : public std::runtime_error
+{
+    using std::runtime_error::runtime_error;
+};
+
+struct receive_timeout : public std::runtime_error
+{
+    using std::runtime_error::runtime_error;
+};
+
+void write_message(int const fd, message_type const type, std::string_view const payload);
+
+// Returns false if the connection was closed before a new message started. Checks the announced payload size
+// against `max_payload_size` before allocating anything.
+bool read_message(int const fd, message & msg, uint64_t const max_payload_size);
@@ -0,0 +1,11 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#pragma once
+
+#include <sharg/all.hpp>
+
+void run_serve(sharg::parser & parser);
+
+void run_client(sharg::parser & parser);
@@ -0,0 +1,13 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#pragma once
+
+#include "configuration.hpp"
+
+// Loads the index once and answers search requests on a Unix domain socket until a client requests a shutdown.
+void serve(configuration const & config);
+
+// Sends the reads to a running server and writes the results like `search` does. Or stops the server.
+void client(configuration const & config);
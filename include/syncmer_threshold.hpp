@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <cereal/types/vector.hpp>
+
+/*!\brief Threshold model for open syncmers (k, s, t).
+ * \details
+ * Whether a k-mer is a syncmer only depends on the k-mer itself. One error changes the k k-mers overlapping it, and
+ * each of them is a syncmer with probability `1 / (k - s + 1)`. Hence, the number of syncmers destroyed by e errors
+ * is modelled as `Binomial(e * k, 1 / (k - s + 1))`. For each number of errors, the model stores how many syncmers
+ * are destroyed with a probability of at least `tau`. A read with n syncmers then needs at least n minus this many
+ * hits in a user bin.
+ * The model does not depend on t: in a random sequence, the smallest s-mer of a k-mer is equally likely at each of the
+ * k - s + 1 positions, so every choice of t yields the same syncmer probability. t only changes which k-mers are
+ * syncmers and how they are spaced, which the binomial model, assuming independent k-mers, does not capture.
+ * The table is computed when building the index and stored in it.
+ */
+class syncmer_threshold
+{
+public:
+    //!\brief The largest number of errors the table covers.
+    static constexpr uint8_t max_errors{5u};
+    static constexpr double tau{0.9999};
+
+    syncmer_threshold() = default;
+    syncmer_threshold(syncmer_threshold const &) = default;
+    syncmer_threshold & operator=(syncmer_threshold const &) = default;
+    syncmer_threshold(syncmer_threshold &&) = default;
+    syncmer_threshold & operator=(syncmer_threshold &&) = default;
+    ~syncmer_threshold() = default;
+
+    syncmer_threshold(uint8_t const kmer_size, uint8_t const s);
+
+    //!\brief Returns the minimum number of hits for a read with `syncmer_count` syncmers and `errors` errors.
+    size_t get(size_t const syncmer_count, uint8_t const errors) const;
+
+    bool empty() const noexcept
+    {
+        return affected_syncmers.empty();
+    }
+
+    template <typename archive_t>
+    void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
+    {
+        archive(affected_syncmers);
+    }
+
+private:
+    //!\brief The number of syncmers destroyed by 0, 1, ..., max_errors errors.
+    std::vector<uint64_t> affected_syncmers{};
+};
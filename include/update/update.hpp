@@ -0,0 +1,10 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#pragma once
+
+#include "configuration.hpp"
+
+// Removes and adds user bins of an existing index without recomputing its layout.
+void update(configuration const & config);
@@ -0,0 +1,202 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include "block_compression.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#include "do_parallel.hpp"
+
+#if defined(SEQAN3_HAS_ZLIB)
+#    include <zlib.h>
+#endif
+
+static constexpr size_t trailer_size{3u * sizeof(uint64_t)};
+
+bool block_compression_available() noexcept
+{
+#if defined(SEQAN3_HAS_ZLIB)
+    return true;
+#else
+    return false;
+#endif
+}
+
+void check_block_compression_available()
+{
+    if (!block_compression_available())
+        throw std::runtime_error{"Compressed indexes are not supported, because zlib was not found at build time."};
+}
+
+static void compress_block(std::span<char const> const block, std::string & compressed)
+{
+#if defined(SEQAN3_HAS_ZLIB)
+    uLongf compressed_size = compressBound(block.size());
+    compressed.resize(compressed_size);
+
+    if (compress2(reinterpret_cast<Bytef *>(compressed.data()),
+                  &compressed_size,
+                  reinterpret_cast<Bytef const *>(block.data()),
+                  block.size(),
+                  Z_BEST_SPEED)
+        != Z_OK)
+        throw std::runtime_error{"Could not compress the index."};
+
+    compressed.resize(compressed_size);
+#else
+    (void)block;
+    (void)compressed;
+#endif
+}
+
+static void decompress_block(std::span<char const> const compressed, std::span<char> const block)
+{
+#if defined(SEQAN3_HAS_ZLIB)
+    uLongf block_size = block.size();
+
+    if (uncompress(reinterpret_cast<Bytef *>(block.data()),
+                   &block_size,
+                   reinterpret_cast<Bytef const *>(compressed.data()),
+                   compressed.size())
+            != Z_OK
+        || block_size != block.size())
+        throw std::runtime_error{"The compressed index is corrupted."};
+#else
+    (void)compressed;
+    (void)block;
+#endif
+}
+
+block_compressing_buffer::block_compressing_buffer(std::ostream & stream,
+                                                   size_t const threads,
+                                                   size_t const block_size) :
+    stream{stream},
+    threads{std::max<size_t>(threads, 1u)},
+    block_size{block_size},
+    buffer(this->threads * block_size)
+{
+    check_block_compression_available();
+    setp(buffer.data(), buffer.data() + buffer.size());
+}
+
+void block_compressing_buffer::compress_buffer()
+{
+    size_t const bytes = pptr() - pbase();
+    size_t const number_of_blocks = (bytes + block_size - 1u) / block_size;
+    compressed_blocks.resize(number_of_blocks);
+
+    auto worker = [&](size_t const start, size_t const extent)
+    {
+        for (size_t i = start; i < start + extent; ++i)
+        {
+            size_t const offset = i * block_size;
+            compress_block({buffer.data() + offset, std::min(block_size, bytes - offset)}, compressed_blocks[i]);
+        }
+    };
+    do_parallel(worker, number_of_blocks, threads);
+
+    for (std::string const & compressed : compressed_blocks)
+    {
+        stream.write(compressed.data(), compressed.size());
+        compressed_sizes.push_back(compressed.size());
+    }
+
+    uncompressed_size += bytes;
+    setp(buffer.data(), buffer.data() + buffer.size());
+}
+
+block_compressing_buffer::int_type block_compressing_buffer::overflow(int_type const character)
+{
+    compress_buffer();
+
+    if (!traits_type::eq_int_type(character, traits_type::eof()))
+    {
+        *pptr() = traits_type::to_char_type(character);
+        pbump(1);
+    }
+
+    return traits_type::not_eof(character);
+}
+
+void block_compressing_buffer::finish()
+{
+    compress_buffer();
+
+    uint64_t const trailer[3]{block_size, compressed_sizes.size(), uncompressed_size};
+    stream.write(reinterpret_cast<char const *>(compressed_sizes.data()), compressed_sizes.size() * sizeof(uint64_t));
+    stream.write(reinterpret_cast<char const *>(trailer), trailer_size);
+
+    if (!stream.good())
+        throw std::runtime_error{"Could not write the compressed index."};
+}
+
+block_decompressing_buffer::block_decompressing_buffer(std::span<char const> const payload, size_t const threads) :
+    threads{std::max<size_t>(threads, 1u)}
+{
+    check_block_compression_available();
+
+    auto corrupted = []()
+    {
+        throw std::runtime_error{"The compressed index is corrupted."};
+    };
+
+    if (payload.size() < trailer_size)
+        corrupted();
+
+    uint64_t trailer[3];
+    std::memcpy(trailer, payload.data() + payload.size() - trailer_size, trailer_size);
+    block_size = trailer[0];
+    uint64_t const number_of_blocks = trailer[1];
+    uncompressed_size = trailer[2];
+
+    if (block_size == 0u || number_of_blocks != (uncompressed_size + block_size - 1u) / block_size
+        || number_of_blocks > (payload.size() - trailer_size) / sizeof(uint64_t))
+        corrupted();
+
+    size_t const table_offset = payload.size() - trailer_size - number_of_blocks * sizeof(uint64_t);
+    std::vector<uint64_t> compressed_sizes(number_of_blocks);
+    std::memcpy(compressed_sizes.data(), payload.data() + table_offset, number_of_blocks * sizeof(uint64_t));
+
+    size_t offset{};
+    blocks.reserve(number_of_blocks);
+    for (uint64_t const compressed_size : compressed_sizes)
+    {
+        if (compressed_size > table_offset - offset)
+            corrupted();
+
+        blocks.emplace_back(payload.data() + offset, compressed_size);
+        offset += compressed_size;
+    }
+
+    buffer.resize(std::min<uint64_t>(this->threads * block_size, uncompressed_size));
+}
+
+block_decompressing_buffer::int_type block_decompressing_buffer::underflow()
+{
+    if (gptr() < egptr())
+        return traits_type::to_int_type(*gptr());
+
+    if (next_block == blocks.size())
+        return traits_type::eof();
+
+    size_t const number_of_blocks = std::min(threads, blocks.size() - next_block);
+    size_t const first_byte = next_block * block_size;
+    size_t const bytes = std::min<uint64_t>(number_of_blocks * block_size, uncompressed_size - first_byte);
+
+    auto worker = [&](size_t const start, size_t const extent)
+    {
+        for (size_t i = start; i < start + extent; ++i)
+        {
+            size_t const offset = i * block_size;
+            decompress_block(blocks[next_block + i], {buffer.data() + offset, std::min(block_size, bytes - offset)});
+        }
+    };
+    do_parallel(worker, number_of_blocks, threads);
+
+    next_block += number_of_blocks;
+    setg(buffer.data(), buffer.data(), buffer.data() + bytes);
+    return traits_type::to_int_type(*gptr());
+}
@@ -8,60 +8,146 @@
 #include <cctype>    // for isspace
 #include <fstream>
 #include <iostream>
+#include <numeric>
+#include <optional>
 #include <string>
 #include <vector>
 
 #include <sharg/validators.hpp>
 
 #include <seqan3/io/sequence_file/all.hpp>
-#include <seqan3/search/views/minimiser_hash.hpp>
 
-#include "contrib/syncmer.hpp"
+#include "build/hash_cache.hpp"
+#include "build/memory_plan.hpp"
+#include "build/tune.hpp"
 #include "dna4_traits.hpp"
+#include "hash_file.hpp"
+#include "hashing.hpp"
 #include "index_data.hpp"
+#include "run_statistics.hpp"
 #include <cereal/archives/binary.hpp>
 #include <hibf/config.hpp>
 #include <hibf/hierarchical_interleaved_bloom_filter.hpp>
 
+// What the input function saw for each user bin. Each user bin has its own slot, so concurrent calls do not share
+// state. A user bin that is read again (the HIBF reads each user bin twice) overwrites its slot with the same values.
+// Parsing and hashing are reported per pass rather than summed over both passes.
+struct input_statistics
+{
+    explicit input_statistics(run_statistics & report, size_t const number_of_user_bins) :
+        report{report},
+        passes(number_of_user_bins),
+        sequences(number_of_user_bins),
+        bases(number_of_user_bins),
+        hashes(number_of_user_bins)
+    {}
+
+    run_statistics & report;
+    std::vector<uint8_t> passes; // How often the user bin was parsed so far.
+    std::vector<uint64_t> sequences;
+    std::vector<uint64_t> bases;
+    std::vector<uint64_t> hashes; // Before deduplication, except for .hashes files.
+};
+
+// The HIBF calls the returned function concurrently for different user bins when `config.threads > 1`.
+// Hence, everything that is modified during a call (file handle, hash buffer) must be local to that call.
+// If `cache` is set, each user bin is parsed and hashed only once. If `stats` is set, parsing and hashing are timed.
 template <hash_type hash>
 std::function<void(size_t, seqan::hibf::insert_iterator &&)>
-get_input_fn_impl(configuration const & config, std::vector<std::string> const & user_bin_paths)
+get_input_fn_impl(configuration const & config,
+                  std::vector<std::string> const & user_bin_paths,
+                  hash_cache * cache,
+                  input_statistics * stats)
 {
     using sequence_file_t = seqan3::sequence_file_input<dna4_traits>;
 
-    auto view = [&]()
+    hash_parameters const parameters{.hash = hash,
+                                     .kmer_size = config.kmer_size,
+                                     .window_size = config.window_size,
+                                     .s = config.s,
+                                     .t = config.t};
+
+    return [&user_bin_paths, parameters, cache, stats](size_t const user_bin_id, seqan::hibf::insert_iterator it)
     {
-        if constexpr (hash == hash_type::minimiser)
+        if (is_hash_file(user_bin_paths[user_bin_id]))
         {
-            return seqan3::views::minimiser_hash(seqan3::ungapped{config.kmer_size},
-                                                 seqan3::window_size{config.window_size});
-        }
-        else
-        {
-            static_assert(hash == hash_type::syncmer);
-            return seqan3::views::syncmer({.kmer_size = config.kmer_size, .smer_size = config.s, .offset = config.t});
+            hash_file const file{user_bin_paths[user_bin_id]};
+            std::ranges::copy(file.hashes(), it);
+
+            if (stats != nullptr)
+                stats->hashes[user_bin_id] = file.hashes().size();
+            return;
         }
-    }();
 
-    return [&, view](size_t const user_bin_id, seqan::hibf::insert_iterator it)
-    {
+        if (cache != nullptr && cache->read(user_bin_id, it))
+            return;
+
+        lap_clock clock{};
+        double parse_seconds{};
+        double hash_seconds{};
+        uint64_t sequences{};
+        uint64_t bases{};
+        uint64_t emitted_hashes{};
+
         sequence_file_t fin{user_bin_paths[user_bin_id]};
+        std::vector<uint64_t> hashes;
+        std::vector<uint64_t> user_bin_hashes;
         for (auto & record : fin)
         {
-            std::ranges::copy(record.sequence() | view, it);
+            if (stats != nullptr)
+                parse_seconds += clock.lap();
+
+            if constexpr (hash == hash_type::minimiser)
+                minimiser_hashes(record.sequence(), parameters, hashes);
+            else
+                syncmer_hashes(record.sequence(), parameters, hashes);
+
+            if (cache != nullptr)
+                user_bin_hashes.insert(user_bin_hashes.end(), hashes.begin(), hashes.end());
+            else
+                std::ranges::copy(hashes, it);
+
+            // Hashing includes handing the hashes to the HIBF.
+            if (stats != nullptr)
+            {
+                hash_seconds += clock.lap();
+                ++sequences;
+                bases += record.sequence().size();
+                emitted_hashes += hashes.size();
+            }
+        }
+
+        if (cache != nullptr)
+        {
+            cache->store(user_bin_id, user_bin_hashes);
+            std::ranges::copy(user_bin_hashes, it);
+        }
+
+        if (stats != nullptr)
+        {
+            stats->sequences[user_bin_id] = sequences;
+            stats->bases[user_bin_id] = bases;
+            stats->hashes[user_bin_id] = emitted_hashes;
+
+            std::string const pass = "_pass_" + std::to_string(++stats->passes[user_bin_id]);
+            stats->report.add_thread_phase("parse" + pass, parse_seconds);
+            stats->report.add_thread_phase("hash" + pass, hash_seconds);
         }
     };
 }
 
 std::function<void(size_t, seqan::hibf::insert_iterator &&)>
-get_input_fn(configuration const & config, std::vector<std::string> const & user_bin_paths)
+get_input_fn(configuration const & config,
+             std::vector<std::string> const & user_bin_paths,
+             hash_cache * cache,
+             input_statistics * stats)
 {
     switch (config.hash)
     {
     case hash_type::minimiser:
-        return get_input_fn_impl<hash_type::minimiser>(config, user_bin_paths);
+        return get_input_fn_impl<hash_type::minimiser>(config, user_bin_paths, cache, stats);
     case hash_type::syncmer:
-        return get_input_fn_impl<hash_type::syncmer>(config, user_bin_paths);
+        return get_input_fn_impl<hash_type::syncmer>(config, user_bin_paths, cache, stats);
     default:
         throw std::runtime_error{"Invalid hash type."};
     }
@@ -72,7 +158,7 @@ std::vector<std::string> parse_user_bins(std::filesystem::path const & file)
     std::vector<std::string> user_bin_paths;
     std::ifstream file_list{file};
     std::string current_line;
-    sharg::input_file_validator fasta_validator{{"fasta", "fa", "fna"}};
+    sharg::input_file_validator fasta_validator{{"fasta", "fa", "fna", "hashes"}};
 
     //Each FASTA file is opened, and the k-mers are extracted from it.
     //These kmers are stored in all_bins_together, with each file corresponding to a "User Bin" in the HIBF
@@ -102,25 +188,132 @@ std::vector<std::string> parse_user_bins(std::filesystem::path const & file)
     return user_bin_paths;
 }
 
-void build(configuration const & config)
+// Throws if a .hashes file was computed with other parameters than `config` specifies.
+void check_hash_files(configuration const & config, std::vector<std::string> const & user_bin_paths)
+{
+    std::string const expected_key = hash_parameters_key({.hash = config.hash,
+                                                          .kmer_size = config.kmer_size,
+                                                          .window_size = config.window_size,
+                                                          .s = config.s,
+                                                          .t = config.t});
+
+    for (std::string const & path : user_bin_paths)
+    {
+        if (!is_hash_file(path))
+            continue;
+
+        hash_file const file{path};
+        if (std::string const key = hash_parameters_key(file.parameters()); key != expected_key)
+            throw std::runtime_error{path + " contains " + key + " hashes, but " + expected_key + " were requested."};
+    }
+}
+
+void build(configuration const & build_config)
 {
-    std::vector<std::string> const user_bin_paths = parse_user_bins(config.file_list_path);
+    configuration config{build_config};
 
-    auto input_fn = get_input_fn(config, user_bin_paths);
+    std::optional<run_statistics> report{};
+    if (!config.stats_output.empty())
+        report.emplace("build");
+    run_statistics * const stats_report = report ? &*report : nullptr;
+
+    std::vector<std::string> user_bin_paths;
+    {
+        run_statistics::scoped_phase const phase{stats_report, "parse_file_list"};
+        user_bin_paths = parse_user_bins(config.file_list_path);
+        check_hash_files(config, user_bin_paths);
+    }
+
+    if (config.tune)
+    {
+        run_statistics::scoped_phase const phase{stats_report, "tune"};
+        tune(config, user_bin_paths);
+    }
+
+    if (config.max_memory != 0u)
+    {
+        // Fails before anything is built if the index cannot fit.
+        memory_plan plan{};
+        {
+            run_statistics::scoped_phase const phase{stats_report, "memory_plan"};
+            plan = plan_memory(config, user_bin_paths, estimate_index_size(config, user_bin_paths));
+        }
+        config.threads = plan.threads;
+        config.cache_hashes = true;
+        config.cache_memory = plan.cache_memory;
+
+        std::cout << "Memory budget of " << config.max_memory << " MiB: about " << (plan.index_size >> 20)
+                  << " MiB for the index, " << config.threads << " thread(s), and a hash cache of "
+                  << config.cache_memory << " MiB.\n";
+    }
+
+    std::optional<hash_cache> cache{};
+    if (config.cache_hashes)
+        cache.emplace(user_bin_paths.size(),
+                      config.cache_memory << 20,
+                      config.tmp_directory.empty() ? std::filesystem::temp_directory_path() : config.tmp_directory);
+
+    std::optional<input_statistics> stats{};
+    if (report)
+        stats.emplace(*report, user_bin_paths.size());
+
+    auto input_fn = get_input_fn(config, user_bin_paths, cache ? &*cache : nullptr, stats ? &*stats : nullptr);
 
     seqan::hibf::config hibf_config{.input_fn = input_fn,                         // required
                                     .number_of_user_bins = user_bin_paths.size(), // required
-                                    .number_of_hash_functions = 2u,
-                                    .maximum_fpr = 0.05,
-                                    .threads = 1u};
+                                    .number_of_hash_functions = config.number_of_hash_functions,
+                                    .maximum_fpr = config.maximum_fpr,
+                                    .relaxed_fpr = config.relaxed_fpr,
+                                    .threads = config.threads,
+                                    .tmax = config.tmax,
+                                    .alpha = config.alpha};
 
     // The HIBF constructor will determine a hierarchical layout for the user bins and build the filter
-    seqan::hibf::hierarchical_interleaved_bloom_filter hibf{hibf_config};
+    std::optional<seqan::hibf::hierarchical_interleaved_bloom_filter> hibf{};
+    {
+        run_statistics::scoped_phase const phase{stats_report, "hibf_construction"};
+        hibf.emplace(hibf_config);
+    }
 
     //The indices can also be stored and loaded from disk by using cereal
-    myindex index{config, std::move(hibf)};
-    index.store(config.index_output);
+    myindex index{config, std::move(*hibf)};
+    {
+        run_statistics::scoped_phase const phase{stats_report, "store"};
+        index.store(config.index_output, config.compress_index, config.threads);
+    }
 
     std::cout << "HIBF index built and saved to " << config.index_output << "\n";
     std::cout << "Successfully processed " << user_bin_paths.size() << " files.\n";
+
+    uint64_t const peak_memory = run_statistics::peak_rss_bytes() >> 20;
+    if (config.max_memory != 0u && peak_memory > config.max_memory)
+        std::cerr << "[WARNING] The build used " << peak_memory << " MiB, more than the memory budget of "
+                  << config.max_memory << " MiB.\n";
+
+    if (report)
+    {
+        // The HIBF's own timers; summed over threads.
+        report->add_thread_phase("hibf_index_allocation", index.hibf.index_allocation_timer.in_seconds());
+        report->add_thread_phase("hibf_user_bin_io", index.hibf.user_bin_io_timer.in_seconds());
+        report->add_thread_phase("hibf_merge_kmers", index.hibf.merge_kmers_timer.in_seconds());
+        report->add_thread_phase("hibf_fill_ibf", index.hibf.fill_ibf_timer.in_seconds());
+
+        uint64_t bytes_read{};
+        for (std::string const & path : user_bin_paths)
+            bytes_read += std::filesystem::file_size(path);
+
+        distribution hashes_per_user_bin{};
+        for (uint64_t const hashes : stats->hashes)
+            hashes_per_user_bin.add(hashes);
+
+        report->add_counter("user_bins", user_bin_paths.size());
+        report->add_counter("sequences", std::accumulate(stats->sequences.begin(), stats->sequences.end(), uint64_t{}));
+        report->add_counter("bases", std::accumulate(stats->bases.begin(), stats->bases.end(), uint64_t{}));
+        report->add_counter("hashes", hashes_per_user_bin.sum);
+        report->add_counter("bytes_read", bytes_read);
+        report->add_counter("bytes_written", std::filesystem::file_size(config.index_output));
+        report->add_distribution("hashes_per_user_bin", hashes_per_user_bin);
+        report->set_list("hashes_per_user_bin", std::move(stats->hashes));
+        report->write(config.stats_output);
+    }
 }
@@ -0,0 +1,96 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include "build/hash_cache.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include <unistd.h>
+
+#include "mapped_file.hpp"
+
+hash_cache::hash_cache(size_t const number_of_user_bins,
+                       size_t const memory_budget,
+                       std::filesystem::path const & tmp_directory) :
+    memory_budget{memory_budget},
+    states(number_of_user_bins),
+    in_memory(number_of_user_bins)
+{
+    // A unique directory, such that concurrent builds do not interfere.
+    std::random_device random_device{};
+    spill_directory = tmp_directory
+                    / ("HIBF-hashing-" + std::to_string(::getpid()) + '-' + std::to_string(random_device()));
+    std::filesystem::create_directories(spill_directory);
+}
+
+hash_cache::~hash_cache()
+{
+    std::error_code error{};
+    std::filesystem::remove_all(spill_directory, error);
+}
+
+std::filesystem::path hash_cache::spill_path(size_t const user_bin_id) const
+{
+    return spill_directory / (std::to_string(user_bin_id) + ".hashes");
+}
+
+bool hash_cache::read(size_t const user_bin_id, seqan::hibf::insert_iterator & it) const
+{
+    switch (states[user_bin_id].load(std::memory_order_acquire))
+    {
+    case entry_state::in_memory:
+        std::ranges::copy(in_memory[user_bin_id], it);
+        return true;
+    case entry_state::spilled:
+    {
+        mapped_file const file{spill_path(user_bin_id)};
+        std::span<char const> const data = file.data();
+        std::ranges::copy(std::span{reinterpret_cast<uint64_t const *>(data.data()), data.size() / sizeof(uint64_t)},
+                          it);
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
+void hash_cache::store(size_t const user_bin_id, std::vector<uint64_t> & hashes)
+{
+    std::ranges::sort(hashes);
+    auto const [first, last] = std::ranges::unique(hashes);
+    hashes.erase(first, last);
+
+    size_t const bytes = hashes.size() * sizeof(uint64_t);
+
+    if (memory_used.fetch_add(bytes, std::memory_order_relaxed) + bytes <= memory_budget)
+    {
+        in_memory[user_bin_id] = hashes;
+        states[user_bin_id].store(entry_state::in_memory, std::memory_order_release);
+        return;
+    }
+
+    memory_used.fetch_sub(bytes, std::memory_order_relaxed);
+
+    std::filesystem::path const path = spill_path(user_bin_id);
+    std::ofstream fout{path, std::ios::binary};
+    fout.write(reinterpret_cast<char const *>(hashes.data()), bytes);
+    if (!fout.good())
+        throw std::runtime_error{"Could not write " + path.string() + '.'};
+    fout.close();
+
+    states[user_bin_id].store(entry_state::spilled, std::memory_order_release);
+}
+
+size_t hash_cache::spilled_user_bins() const noexcept
+{
+    return std::ranges::count_if(states,
+                                 [](std::atomic<entry_state> const & state)
+                                 {
+                                     return state.load(std::memory_order_relaxed) == entry_state::spilled;
+                                 });
+}
@@ -0,0 +1,65 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include "build/memory_plan.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+
+#include "hash_file.hpp"
+
+// Rounded up, so that small sizes are not reported as 0 MiB.
+static uint64_t mebibytes(uint64_t const bytes)
+{
+    return (bytes + (1u << 20) - 1u) >> 20;
+}
+
+// Bytes per hash while a user bin is processed: the hash buffer, the cached copy, and the hash sets of merged bins.
+static constexpr uint64_t bytes_per_hash{32u};
+
+double hash_density(configuration const & config)
+{
+    // Random sequences: a window of w - k + 1 k-mers yields about 2 / (w - k + 2) minimisers per base, and an open
+    // syncmer occurs at about 1 / (k - s + 1) of the positions.
+    if (config.hash == hash_type::syncmer)
+        return 1.0 / (config.kmer_size - config.s + 1);
+    return 2.0 / (config.window_size - config.kmer_size + 2);
+}
+
+memory_plan plan_memory(configuration const & config,
+                        std::vector<std::string> const & user_bin_paths,
+                        uint64_t const index_size)
+{
+    uint64_t const budget = config.max_memory << 20;
+    double const density = hash_density(config);
+
+    uint64_t largest_hash_count{};
+    for (std::string const & path : user_bin_paths)
+    {
+        // A FASTA file has about one base per byte; a .hashes file knows its size.
+        uint64_t const hash_count = is_hash_file(path)
+                                      ? hash_file{path}.hashes().size()
+                                      : static_cast<uint64_t>(std::filesystem::file_size(path) * density);
+        largest_hash_count = std::max(largest_hash_count, hash_count);
+    }
+
+    memory_plan plan{.index_size = index_size,
+                     .largest_user_bin = std::max<uint64_t>(largest_hash_count * bytes_per_hash, 1u)};
+
+    if (plan.index_size + plan.largest_user_bin > budget)
+        throw std::runtime_error{"The index needs about " + std::to_string(mebibytes(plan.index_size))
+                                 + " MiB and the largest user bin about "
+                                 + std::to_string(mebibytes(plan.largest_user_bin))
+                                 + " MiB, more than the memory budget of " + std::to_string(config.max_memory)
+                                 + " MiB."};
+
+    uint64_t const rest = budget - plan.index_size;
+    // At most config.threads, so the cast does not truncate.
+    plan.threads = static_cast<uint16_t>(std::clamp<uint64_t>(rest / 2u / plan.largest_user_bin, 1u, config.threads));
+    plan.cache_memory = (rest / 4u) >> 20;
+
+    return plan;
+}
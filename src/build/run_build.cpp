@@ -4,8 +4,28 @@
 
 #include "build/run_build.hpp"
 
+#include <string>
+
 #include "build/build.hpp"
 #include "configuration.hpp"
+#include "hash_options.hpp"
+
+// Accepts values strictly between 0 and 1, as a false positive rate of 0 or 1 cannot be met.
+struct fpr_validator
+{
+    using option_value_type = double;
+
+    void operator()(double const fpr) const
+    {
+        if (!(fpr > 0.0 && fpr < 1.0))
+            throw sharg::validation_error{"Value " + std::to_string(fpr) + " is not in range (0,1)."};
+    }
+
+    std::string get_help_page_message() const
+    {
+        return "Value must be in range (0,1).";
+    }
+};
 
 void add_shared_options(sharg::parser & parser, configuration & config)
 {
@@ -13,7 +33,7 @@ void add_shared_options(sharg::parser & parser, configuration & config)
     parser.add_option(config.file_list_path,
                       sharg::config{.short_id = 'i',
                                     .long_id = "input",
-                                    .description = "A file containing one sequence file per line",
+                                    .description = "A file containing one sequence file or .hashes file per line",
                                     .required = true,
                                     .validator = sharg::input_file_validator{}});
     parser.add_option(
@@ -22,6 +42,84 @@ void add_shared_options(sharg::parser & parser, configuration & config)
                       .long_id = "output",
                       .description = "Where to store the index.",
                       .validator = sharg::output_file_validator{sharg::output_file_open_options::open_or_create}});
+    parser.add_option(config.threads,
+                      sharg::config{.long_id = "threads",
+                                    .description = "The number of threads to use.",
+                                    .validator = sharg::arithmetic_range_validator{1, 1024}});
+    parser.add_flag(config.compress_index,
+                    sharg::config{.long_id = "compress",
+                                  .description = "Store the index in independently compressed blocks. Loading "
+                                                 "decompresses the blocks in parallel."});
+    parser.add_flag(config.cache_hashes,
+                    sharg::config{.long_id = "cache_hashes",
+                                  .description = "Parse and hash each input file only once. The hashes are kept in "
+                                                 "memory and written to --tmp_dir when exceeding --cache_memory."});
+    parser.add_option(config.cache_memory,
+                      sharg::config{.long_id = "cache_memory",
+                                    .description = "Memory budget of --cache_hashes in MiB."});
+    parser.add_option(config.tmp_directory,
+                      sharg::config{.long_id = "tmp_dir",
+                                    .description = "Directory for temporary files. Defaults to the system's "
+                                                   "temporary directory."});
+    parser.add_option(config.max_memory,
+                      sharg::config{.long_id = "max_memory",
+                                    .description = "Memory budget of the build in MiB. The size of the index is "
+                                                   "estimated from --tune_sample user bins, and the build fails early "
+                                                   "if it does not fit. Implies --cache_hashes, overrides "
+                                                   "--cache_memory, and may reduce --threads. 0 means no limit."});
+    parser.add_option(config.stats_output,
+                      sharg::config{.long_id = "stats",
+                                    .description = "Write the time per phase, counters, and peak memory as JSON to "
+                                                   "this file. The HIBF reads each user bin twice; parsing and "
+                                                   "hashing are reported per pass."});
+
+    parser.add_subsection("HIBF options");
+    parser.add_option(config.number_of_hash_functions,
+                      sharg::config{.long_id = "hash_functions",
+                                    .description = "The number of hash functions of each Bloom filter.",
+                                    .validator = sharg::arithmetic_range_validator{1, 5}});
+    parser.add_option(config.maximum_fpr,
+                      sharg::config{.long_id = "fpr",
+                                    .description = "The maximum false positive rate of each technical bin.",
+                                    .validator = fpr_validator{}});
+    parser.add_option(config.relaxed_fpr,
+                      sharg::config{.long_id = "relaxed_fpr",
+                                    .description = "The false positive rate of merged bins. Must be at least --fpr.",
+                                    .validator = fpr_validator{}});
+    parser.add_option(config.tmax,
+                      sharg::config{.long_id = "tmax",
+                                    .description = "The maximum number of technical bins of each IBF.",
+                                    .default_message = "sqrt(number of user bins), rounded up to a multiple of 64"});
+    parser.add_option(config.alpha,
+                      sharg::config{.long_id = "alpha",
+                                    .description = "How much the layout favours fewer lower levels over a smaller "
+                                                   "index."});
+
+    parser.add_subsection("Tuning options");
+    parser.add_flag(config.tune,
+                    sharg::config{.long_id = "tune",
+                                  .description = "Choose --hash_functions and --fpr by building indexes for a "
+                                                 "sample of the user bins. Prints the considered configurations."});
+    parser.add_option(config.tune_memory,
+                      sharg::config{.long_id = "tune_memory",
+                                    .description = "With --tune, use the fastest configuration whose index fits in "
+                                                   "this many MiB. 0 means no limit."});
+    parser.add_option(config.tune_query_cost,
+                      sharg::config{.long_id = "tune_query_cost",
+                                    .description = "With --tune, use the smallest configuration that reads at most "
+                                                   "this many 64-bit words per query hash. 0 means no limit."});
+    parser.add_option(config.tune_sample,
+                      sharg::config{.long_id = "tune_sample",
+                                    .description = "With --tune, the number of user bins to build sample indexes "
+                                                   "for.",
+                                    .validator = sharg::arithmetic_range_validator{1, 1000000}});
+}
+
+void check_hibf_options(configuration const & config)
+{
+    if (config.relaxed_fpr < config.maximum_fpr)
+        throw sharg::validation_error{"--relaxed_fpr (" + std::to_string(config.relaxed_fpr)
+                                      + ") must be at least --fpr (" + std::to_string(config.maximum_fpr) + ")."};
 }
 
 void run_minimiser(sharg::parser & parser)
@@ -29,28 +127,12 @@ void run_minimiser(sharg::parser & parser)
     configuration config{.hash = hash_type::minimiser};
 
     add_shared_options(parser, config);
-
-    parser.add_subsection("Minimizer options");
-    parser.add_option(config.kmer_size,
-                      sharg::config{.short_id = 'k',
-                                    .long_id = "kmer",
-                                    .description = "The k-mer size to use.",
-                                    .validator = sharg::arithmetic_range_validator{1, 32}});
-
-    parser.add_option(config.window_size,
-                      sharg::config{.short_id = 'w',
-                                    .long_id = "window",
-                                    .description = "The window size for minimisers.",
-                                    .default_message = "k-mer size",
-                                    .validator = sharg::arithmetic_range_validator{1, 200}});
+    add_minimiser_options(parser, config);
 
     parser.parse();
 
-    // Make window default to kmer size if not set.
-    if (!parser.is_option_set("window"))
-        config.window_size = config.kmer_size;
-    else if (config.window_size < config.kmer_size)
-        throw std::runtime_error{"Window size must be greater than or equal to k-mer size."};
+    check_minimiser_options(parser, config);
+    check_hibf_options(config);
 
     build(config);
 }
@@ -60,30 +142,12 @@ void run_syncmer(sharg::parser & parser)
     configuration config{.hash = hash_type::syncmer};
 
     add_shared_options(parser, config);
-
-    parser.add_subsection("Syncmer options");
-    parser.add_option(config.kmer_size,
-                      sharg::config{.short_id = 'k',
-                                    .long_id = "kmer",
-                                    .description = "The k-mer size to use.",
-                                    .validator = sharg::arithmetic_range_validator{1, 32}});
-    parser.add_option(config.s,
-                      sharg::config{.short_id = 's',
-                                    .long_id = "syncmer_s",
-                                    .description = "length of the smaller s-mer.",
-                                    .validator = sharg::arithmetic_range_validator{1, 32}});
-    parser.add_option(config.t,
-                      sharg::config{.short_id = 't',
-                                    .long_id = "syncmer_t",
-                                    .description = "position within the k-mer at which the minimal s-mer must occur.",
-                                    .validator = sharg::arithmetic_range_validator{0, 32}});
+    add_syncmer_options(parser, config);
 
     parser.parse();
 
-    if (config.s >= config.kmer_size)
-        throw std::invalid_argument{"Syncmer s-mer size must be smaller than k-mer size."};
-    if (config.t > config.kmer_size - config.s)
-        throw std::invalid_argument{"Syncmer offset t is out of bounds."};
+    check_syncmer_options(config);
+    check_hibf_options(config);
 
     build(config);
 }
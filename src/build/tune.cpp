@@ -0,0 +1,195 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include "build/tune.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <ranges>
+#include <tuple>
+
+#include "hash/hash.hpp"
+#include "hash_file.hpp"
+#include <hibf/config.hpp>
+#include <hibf/hierarchical_interleaved_bloom_filter.hpp>
+
+static constexpr std::array<uint8_t, 4> candidate_hash_functions{1u, 2u, 3u, 4u};
+static constexpr std::array<double, 3> candidate_fprs{0.01, 0.05, 0.1};
+
+// The HIBF's default: sqrt(user bins), rounded up to a multiple of 64.
+static uint64_t default_tmax(uint64_t const number_of_user_bins)
+{
+    uint64_t const root = std::ceil(std::sqrt(number_of_user_bins));
+    return (root + 63u) / 64u * 64u;
+}
+
+double estimate_query_cost(uint8_t const number_of_hash_functions,
+                           double const maximum_fpr,
+                           uint64_t const number_of_user_bins,
+                           uint64_t const tmax)
+{
+    // The root is always queried. On each lower level, the true hit is followed into one IBF, and each false positive
+    // merged bin of a queried IBF sends the lookup into another one. A level cannot have more IBFs than `ibfs`.
+    double ibfs_queried{1.0};
+    double visits{1.0};
+    double ibfs{1.0};
+    for (uint64_t capacity = tmax; capacity < number_of_user_bins; capacity *= tmax)
+    {
+        ibfs *= static_cast<double>(tmax);
+        visits = std::min(1.0 + visits * static_cast<double>(tmax) * maximum_fpr, ibfs);
+        ibfs_queried += visits;
+    }
+
+    return number_of_hash_functions * ibfs_queried * static_cast<double>((tmax + 63u) / 64u);
+}
+
+// Every n-th user bin, so that the sample is reproducible and covers the whole file list.
+static std::vector<std::vector<uint64_t>> hash_sample(configuration const & config,
+                                                      std::vector<std::string> const & user_bin_paths)
+{
+    hash_parameters const parameters{.hash = config.hash,
+                                     .kmer_size = config.kmer_size,
+                                     .window_size = config.window_size,
+                                     .s = config.s,
+                                     .t = config.t};
+
+    size_t const sample_size = std::clamp<size_t>(config.tune_sample, 1u, user_bin_paths.size());
+    std::vector<std::vector<uint64_t>> sample(sample_size);
+
+    for (size_t i = 0; i < sample_size; ++i)
+    {
+        std::string const & path = user_bin_paths[i * user_bin_paths.size() / sample_size];
+
+        if (is_hash_file(path))
+        {
+            hash_file const file{path};
+            sample[i].assign(file.hashes().begin(), file.hashes().end());
+        }
+        else
+        {
+            hash_user_bin(path, parameters, sample[i]);
+        }
+    }
+
+    return sample;
+}
+
+static uint64_t sample_index_size(configuration const & config,
+                                  std::vector<std::vector<uint64_t>> const & sample,
+                                  uint8_t const number_of_hash_functions,
+                                  double const maximum_fpr)
+{
+    auto input_fn = [&sample](size_t const user_bin_id, seqan::hibf::insert_iterator it)
+    {
+        std::ranges::copy(sample[user_bin_id], it);
+    };
+
+    seqan::hibf::config hibf_config{.input_fn = input_fn,
+                                    .number_of_user_bins = sample.size(),
+                                    .number_of_hash_functions = number_of_hash_functions,
+                                    .maximum_fpr = maximum_fpr,
+                                    .relaxed_fpr = config.relaxed_fpr,
+                                    .threads = config.threads,
+                                    .tmax = config.tmax,
+                                    .alpha = config.alpha};
+
+    seqan::hibf::hierarchical_interleaved_bloom_filter const hibf{hibf_config};
+
+    uint64_t bits{};
+    for (auto const & ibf : hibf.ibf_vector)
+        bits += ibf.bit_size();
+    return bits / 8u;
+}
+
+uint64_t estimate_index_size(configuration const & config, std::vector<std::string> const & user_bin_paths)
+{
+    std::vector<std::vector<uint64_t>> const sample = hash_sample(config, user_bin_paths);
+    double const scale = static_cast<double>(user_bin_paths.size()) / sample.size();
+    return static_cast<uint64_t>(
+        scale * sample_index_size(config, sample, config.number_of_hash_functions, config.maximum_fpr));
+}
+
+static void print_candidates(std::vector<tuning_candidate> const & candidates,
+                             tuning_candidate const & chosen,
+                             size_t const sample_size,
+                             size_t const number_of_user_bins)
+{
+    std::cout << "Tuning on " << sample_size << " of " << number_of_user_bins << " user bins:\n";
+    std::cout << "hash functions\tFPR\testimated size (MiB)\tquery cost (words/hash)\n";
+
+    for (tuning_candidate const & candidate : candidates)
+    {
+        bool const is_chosen = candidate.number_of_hash_functions == chosen.number_of_hash_functions
+                            && candidate.maximum_fpr == chosen.maximum_fpr;
+
+        std::cout << static_cast<uint16_t>(candidate.number_of_hash_functions) << '\t' << candidate.maximum_fpr << '\t'
+                  << std::fixed << std::setprecision(2) << candidate.index_size / 1048576.0 << '\t'
+                  << std::setprecision(1) << candidate.query_cost << std::defaultfloat << std::setprecision(6)
+                  << (is_chosen ? "\t<- chosen\n" : "\n");
+    }
+}
+
+void tune(configuration & config, std::vector<std::string> const & user_bin_paths)
+{
+    std::vector<std::vector<uint64_t>> const sample = hash_sample(config, user_bin_paths);
+    double const scale = static_cast<double>(user_bin_paths.size()) / sample.size();
+    uint64_t const tmax = (config.tmax == 0u) ? default_tmax(user_bin_paths.size()) : config.tmax;
+
+    std::vector<tuning_candidate> candidates;
+    for (uint8_t const number_of_hash_functions : candidate_hash_functions)
+        for (double const maximum_fpr : candidate_fprs | std::views::filter(
+                                            [&config](double const fpr)
+                                            {
+                                                return fpr <= config.relaxed_fpr; // Merged bins may not be stricter.
+                                            }))
+            candidates.push_back(
+                {.number_of_hash_functions = number_of_hash_functions,
+                 .maximum_fpr = maximum_fpr,
+                 .index_size = static_cast<uint64_t>(
+                     scale * sample_index_size(config, sample, number_of_hash_functions, maximum_fpr)),
+                 .query_cost =
+                     estimate_query_cost(number_of_hash_functions, maximum_fpr, user_bin_paths.size(), tmax)});
+
+    uint64_t const memory_budget = config.tune_memory << 20;
+    auto fits = [&](tuning_candidate const & candidate)
+    {
+        return (memory_budget == 0u || candidate.index_size <= memory_budget)
+            && (config.tune_query_cost == 0.0 || candidate.query_cost <= config.tune_query_cost);
+    };
+
+    // With a memory budget, the fastest candidate wins; otherwise the smallest. Ties go to the lower FPR.
+    auto better = [&](tuning_candidate const & lhs, tuning_candidate const & rhs)
+    {
+        if (memory_budget != 0u)
+            return std::tie(lhs.query_cost, lhs.maximum_fpr, lhs.index_size)
+                 < std::tie(rhs.query_cost, rhs.maximum_fpr, rhs.index_size);
+        return std::tie(lhs.index_size, lhs.maximum_fpr, lhs.query_cost)
+             < std::tie(rhs.index_size, rhs.maximum_fpr, rhs.query_cost);
+    };
+
+    std::vector<tuning_candidate> feasible;
+    std::ranges::copy_if(candidates, std::back_inserter(feasible), fits);
+
+    tuning_candidate chosen{};
+    if (feasible.empty())
+    {
+        // Nothing fits: take whatever comes closest to the violated target.
+        chosen = (memory_budget != 0u) ? std::ranges::min(candidates, {}, &tuning_candidate::index_size)
+                                       : std::ranges::min(candidates, {}, &tuning_candidate::query_cost);
+        std::cerr << "[WARNING] No configuration meets the tuning targets. Using the closest one.\n";
+    }
+    else
+    {
+        chosen = std::ranges::min(feasible, better);
+    }
+
+    print_candidates(candidates, chosen, sample.size(), user_bin_paths.size());
+
+    config.number_of_hash_functions = chosen.number_of_hash_functions;
+    config.maximum_fpr = chosen.maximum_fpr;
+}
@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include "hash/hash.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <set>
+
+#include <seqan3/io/sequence_file/all.hpp>
+
+#include "build/build.hpp"
+#include "dna4_traits.hpp"
+#include "do_parallel.hpp"
+#include "hash_file.hpp"
+#include "hashing.hpp"
+
+void hash_user_bin(std::filesystem::path const & path,
+                   hash_parameters const & parameters,
+                   std::vector<uint64_t> & hashes)
+{
+    hashes.clear();
+    std::vector<uint64_t> record_hashes;
+
+    seqan3::sequence_file_input<dna4_traits> fin{path};
+    for (auto & record : fin)
+    {
+        compute_hashes(record.sequence(), parameters, record_hashes);
+        hashes.insert(hashes.end(), record_hashes.begin(), record_hashes.end());
+    }
+
+    std::ranges::sort(hashes);
+    auto const [first, last] = std::ranges::unique(hashes);
+    hashes.erase(first, last);
+}
+
+void hash_user_bins(configuration const & config)
+{
+    std::vector<std::string> const user_bin_paths = parse_user_bins(config.file_list_path);
+
+    hash_parameters const parameters{.hash = config.hash,
+                                     .kmer_size = config.kmer_size,
+                                     .window_size = config.window_size,
+                                     .s = config.s,
+                                     .t = config.t};
+    std::string const key = hash_parameters_key(parameters);
+
+    std::filesystem::create_directories(config.hash_output_directory);
+    std::filesystem::path const output_directory = std::filesystem::absolute(config.hash_output_directory);
+
+    // <output directory>/<file name without extension>.<key>.hashes
+    std::vector<std::filesystem::path> output_paths;
+    std::set<std::filesystem::path> unique_output_paths;
+    for (std::filesystem::path const user_bin_path : user_bin_paths)
+    {
+        if (is_hash_file(user_bin_path))
+            throw std::runtime_error{user_bin_path.string() + " already contains hashes."};
+
+        std::filesystem::path output_path = output_directory / user_bin_path.stem();
+        output_path += '.' + key + std::string{hash_file_extension};
+
+        if (!unique_output_paths.insert(output_path).second)
+            throw std::runtime_error{"Multiple input files would be written to " + output_path.string()
+                                     + ". Please rename them."};
+
+        output_paths.push_back(std::move(output_path));
+    }
+
+    auto worker = [&](size_t const start, size_t const extent)
+    {
+        std::vector<uint64_t> hashes;
+
+        for (size_t user_bin_id = start; user_bin_id < start + extent; ++user_bin_id)
+        {
+            hash_user_bin(user_bin_paths[user_bin_id], parameters, hashes);
+            write_hash_file(output_paths[user_bin_id], parameters, hashes);
+        }
+    };
+    do_parallel(worker, user_bin_paths.size(), config.threads);
+
+    // The same order as the input file list, such that the user bin IDs of the index do not change.
+    std::filesystem::path const file_list_path = output_directory / (key + ".txt");
+    std::ofstream file_list{file_list_path};
+    for (std::filesystem::path const & output_path : output_paths)
+        file_list << output_path.string() << '\n';
+
+    std::cout << "Hashes of " << user_bin_paths.size() << " files written to " << config.hash_output_directory
+              << "\n";
+    std::cout << "File list for build: " << file_list_path << "\n";
+}
@@ -0,0 +1,69 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include "hash/run_hash.hpp"
+
+#include "configuration.hpp"
+#include "hash/hash.hpp"
+#include "hash_options.hpp"
+
+void add_hash_shared_options(sharg::parser & parser, configuration & config)
+{
+    parser.add_subsection("General options");
+    parser.add_option(config.file_list_path,
+                      sharg::config{.short_id = 'i',
+                                    .long_id = "input",
+                                    .description = "A file containing one sequence file per line",
+                                    .required = true,
+                                    .validator = sharg::input_file_validator{}});
+    parser.add_option(config.hash_output_directory,
+                      sharg::config{.short_id = 'o',
+                                    .long_id = "output",
+                                    .description = "Directory to write the .hashes files and the file list to."});
+    parser.add_option(config.threads,
+                      sharg::config{.long_id = "threads",
+                                    .description = "The number of threads to use.",
+                                    .validator = sharg::arithmetic_range_validator{1, 1024}});
+}
+
+void run_hash_minimiser(sharg::parser & parser)
+{
+    configuration config{.hash = hash_type::minimiser};
+
+    add_hash_shared_options(parser, config);
+    add_minimiser_options(parser, config);
+
+    parser.parse();
+
+    check_minimiser_options(parser, config);
+
+    hash_user_bins(config);
+}
+
+void run_hash_syncmer(sharg::parser & parser)
+{
+    configuration config{.hash = hash_type::syncmer};
+
+    add_hash_shared_options(parser, config);
+    add_syncmer_options(parser, config);
+
+    parser.parse();
+
+    check_syncmer_options(config);
+
+    hash_user_bins(config);
+}
+
+void run_hash(sharg::parser & parser)
+{
+    parser.add_subcommands({"minimiser", "syncmer"});
+    parser.parse();
+
+    sharg::parser & sub_parser = parser.get_sub_parser();
+
+    if (sub_parser.info.app_name == std::string_view{"HIBF-hashing-hash-minimiser"})
+        run_hash_minimiser(sub_parser);
+    else if (sub_parser.info.app_name == std::string_view{"HIBF-hashing-hash-syncmer"})
+        run_hash_syncmer(sub_parser);
+}
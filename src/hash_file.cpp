@@ -0,0 +1,84 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include "hash_file.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+static constexpr std::array<char, 8> hash_file_magic{'H', 'I', 'B', 'F', 'H', 'S', 'E', 'T'};
+static constexpr uint32_t hash_file_version{1u};
+static constexpr size_t hash_file_header_size{32u};
+
+std::string hash_parameters_key(hash_parameters const & parameters)
+{
+    std::string const k = std::to_string(parameters.kmer_size);
+
+    switch (parameters.hash)
+    {
+    case hash_type::minimiser:
+        return "minimiser_k" + k + "_w" + std::to_string(parameters.window_size);
+    case hash_type::syncmer:
+        return "syncmer_k" + k + "_s" + std::to_string(parameters.s) + "_t" + std::to_string(parameters.t);
+    default:
+        throw std::runtime_error{"Invalid hash type."};
+    }
+}
+
+bool is_hash_file(std::filesystem::path const & path)
+{
+    return path.extension() == hash_file_extension;
+}
+
+void write_hash_file(std::filesystem::path const & path,
+                     hash_parameters const & parameters,
+                     std::span<uint64_t const> const hashes)
+{
+    std::array<char, hash_file_header_size> header{};
+    std::ranges::copy(hash_file_magic, header.begin());
+    std::memcpy(header.data() + 8u, &hash_file_version, sizeof(hash_file_version));
+    header[12] = static_cast<char>(parameters.kmer_size);
+    header[13] = static_cast<char>(parameters.window_size);
+    header[14] = static_cast<char>(parameters.s);
+    header[15] = static_cast<char>(parameters.t);
+    header[16] = static_cast<char>(parameters.hash);
+    uint64_t const number_of_hashes = hashes.size();
+    std::memcpy(header.data() + 24u, &number_of_hashes, sizeof(number_of_hashes));
+
+    std::ofstream fout{path, std::ios::binary};
+    fout.write(header.data(), header.size());
+    fout.write(reinterpret_cast<char const *>(hashes.data()), hashes.size_bytes());
+
+    if (!fout.good())
+        throw std::runtime_error{"Could not write " + path.string() + '.'};
+}
+
+hash_file::hash_file(std::filesystem::path const & path) : file{path}
+{
+    std::span<char const> const data = file.data();
+
+    if (data.size() < hash_file_header_size || !std::ranges::equal(data.first(8u), hash_file_magic))
+        throw std::runtime_error{path.string() + " is not a .hashes file."};
+
+    uint32_t version{};
+    std::memcpy(&version, data.data() + 8u, sizeof(version));
+    if (version != hash_file_version)
+        throw std::runtime_error{path.string() + " has version " + std::to_string(version) + ", but version "
+                                 + std::to_string(hash_file_version) + " is required. Please recompute it."};
+
+    file_parameters = hash_parameters{.hash = static_cast<hash_type>(data[16]),
+                                      .kmer_size = static_cast<uint8_t>(data[12]),
+                                      .window_size = static_cast<uint8_t>(data[13]),
+                                      .s = static_cast<uint8_t>(data[14]),
+                                      .t = static_cast<uint8_t>(data[15])};
+
+    uint64_t number_of_hashes{};
+    std::memcpy(&number_of_hashes, data.data() + 24u, sizeof(number_of_hashes));
+    if (number_of_hashes * sizeof(uint64_t) != data.size() - hash_file_header_size)
+        throw std::runtime_error{path.string() + " is truncated."};
+
+    file_hashes = {reinterpret_cast<uint64_t const *>(data.data() + hash_file_header_size), number_of_hashes};
+}
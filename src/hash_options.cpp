@@ -0,0 +1,59 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include "hash_options.hpp"
+
+void add_minimiser_options(sharg::parser & parser, configuration & config)
+{
+    parser.add_subsection("Minimizer options");
+    parser.add_option(config.kmer_size,
+                      sharg::config{.short_id = 'k',
+                                    .long_id = "kmer",
+                                    .description = "The k-mer size to use.",
+                                    .validator = sharg::arithmetic_range_validator{1, 32}});
+
+    parser.add_option(config.window_size,
+                      sharg::config{.short_id = 'w',
+                                    .long_id = "window",
+                                    .description = "The window size for minimisers.",
+                                    .default_message = "k-mer size",
+                                    .validator = sharg::arithmetic_range_validator{1, 200}});
+}
+
+void check_minimiser_options(sharg::parser & parser, configuration & config)
+{
+    // Make window default to kmer size if not set.
+    if (!parser.is_option_set("window"))
+        config.window_size = config.kmer_size;
+    else if (config.window_size < config.kmer_size)
+        throw std::runtime_error{"Window size must be greater than or equal to k-mer size."};
+}
+
+void add_syncmer_options(sharg::parser & parser, configuration & config)
+{
+    parser.add_subsection("Syncmer options");
+    parser.add_option(config.kmer_size,
+                      sharg::config{.short_id = 'k',
+                                    .long_id = "kmer",
+                                    .description = "The k-mer size to use.",
+                                    .validator = sharg::arithmetic_range_validator{1, 32}});
+    parser.add_option(config.s,
+                      sharg::config{.short_id = 's',
+                                    .long_id = "syncmer_s",
+                                    .description = "length of the smaller s-mer.",
+                                    .validator = sharg::arithmetic_range_validator{1, 32}});
+    parser.add_option(config.t,
+                      sharg::config{.short_id = 't',
+                                    .long_id = "syncmer_t",
+                                    .description = "position within the k-mer at which the minimal s-mer must occur.",
+                                    .validator = sharg::arithmetic_range_validator{0, 32}});
+}
+
+void check_syncmer_options(configuration const & config)
+{
+    if (config.s >= config.kmer_size)
+        throw std::invalid_argument{"Syncmer s-mer size must be smaller than k-mer size."};
+    if (config.t > config.kmer_size - config.s)
+        throw std::invalid_argument{"Syncmer offset t is out of bounds."};
+}
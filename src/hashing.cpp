@@ -0,0 +1,196 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include "hashing.hpp"
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+
+#include "contrib/syncmer.hpp"
+
+// The seed that `seqan3::views::minimiser_hash` uses by default.
+static constexpr uint64_t minimiser_seed{0x8F3F73B5CF1C9ADEULL};
+
+void minimiser_hashes(std::span<seqan3::dna4 const> const sequence,
+                      hash_parameters const & parameters,
+                      std::vector<uint64_t> & hashes)
+{
+    hashes.clear();
+
+    size_t const kmer_size = parameters.kmer_size;
+    if (sequence.size() < kmer_size)
+        return;
+
+    // Like seqan3, a sequence with fewer k-mers than a window has one window spanning all k-mers.
+    size_t const number_of_kmers = sequence.size() - kmer_size + 1u;
+    size_t const kmers_per_window = std::min<size_t>(parameters.window_size - kmer_size + 1u, number_of_kmers);
+
+    uint64_t const kmer_mask = (kmer_size == 32u) ? ~0ULL : (1ULL << (2u * kmer_size)) - 1u;
+    size_t const rc_shift = 2u * (kmer_size - 1u);
+
+    // The window holds at most 200 - 1 + 1 k-mers (see the window size validator).
+    static constexpr size_t capacity{256u};
+    std::array<uint64_t, capacity> window{};
+
+    uint64_t fwd_kmer{};
+    uint64_t rc_kmer{};
+    uint64_t min_value{};
+    size_t min_index{};
+
+    // Finds the last occurrence of the minimum in the window ending with k-mer `last_index`.
+    auto find_minimum = [&](size_t const last_index)
+    {
+        size_t const first_index = last_index + 1u - kmers_per_window;
+        min_value = window[first_index % capacity];
+        min_index = first_index;
+        for (size_t index = first_index + 1u; index <= last_index; ++index)
+        {
+            if (window[index % capacity] <= min_value)
+            {
+                min_value = window[index % capacity];
+                min_index = index;
+            }
+        }
+    };
+
+    for (size_t position = 0u; position < sequence.size(); ++position)
+    {
+        uint64_t const rank = seqan3::to_rank(sequence[position]);
+        fwd_kmer = ((fwd_kmer << 2) | rank) & kmer_mask;
+        rc_kmer = (rc_kmer >> 2) | ((rank ^ 3u) << rc_shift);
+
+        if (position + 1u < kmer_size)
+            continue;
+
+        size_t const kmer_index = position + 1u - kmer_size;
+        uint64_t const value = std::min(fwd_kmer ^ minimiser_seed, rc_kmer ^ minimiser_seed);
+        window[kmer_index % capacity] = value;
+
+        if (kmer_index + 1u < kmers_per_window)
+            continue;
+
+        if (kmer_index + 1u == kmers_per_window || min_index + kmers_per_window == kmer_index)
+        {
+            // First window or the minimum left the window.
+            find_minimum(kmer_index);
+            hashes.push_back(min_value);
+        }
+        else if (value < min_value)
+        {
+            min_value = value;
+            min_index = kmer_index;
+            hashes.push_back(min_value);
+        }
+    }
+}
+
+void syncmer_hashes(std::span<seqan3::dna4 const> const sequence,
+                    hash_parameters const & parameters,
+                    std::vector<uint64_t> & hashes)
+{
+    hashes.clear();
+
+    size_t const kmer_size = parameters.kmer_size;
+    size_t const smer_size = parameters.s;
+    size_t const offset = parameters.t;
+    if (sequence.size() < kmer_size)
+        return;
+
+    size_t const smers_per_kmer = kmer_size - smer_size + 1u;
+    uint64_t const kmer_mask = (kmer_size == 32u) ? ~0ULL : (1ULL << (2u * kmer_size)) - 1u;
+    uint64_t const smer_mask = (1ULL << (2u * smer_size)) - 1u;
+    size_t const rc_kmer_shift = 2u * (kmer_size - 1u);
+    size_t const rc_smer_shift = 2u * (smer_size - 1u);
+
+    // Same state and tie-breaking as `seqan3::detail::syncmer_view::basic_iterator`.
+    seqan3::detail::smer_window<false> fwd_smer_values{};
+    seqan3::detail::smer_window<true> rc_smer_values{};
+
+    uint64_t fwd_kmer{};
+    uint64_t rc_kmer{};
+    uint64_t fwd_smer{};
+    uint64_t rc_smer{};
+    uint64_t fwd_min_value{};
+    uint64_t rc_min_value{};
+    size_t fwd_min_index{};
+    size_t rc_min_index{};
+    size_t smer_count{};
+
+    for (size_t position = 0u; position < sequence.size(); ++position)
+    {
+        uint64_t const rank = seqan3::to_rank(sequence[position]);
+        fwd_kmer = ((fwd_kmer << 2) | rank) & kmer_mask;
+        rc_kmer = (rc_kmer >> 2) | ((rank ^ 3u) << rc_kmer_shift);
+        fwd_smer = ((fwd_smer << 2) | rank) & smer_mask;
+        rc_smer = (rc_smer >> 2) | ((rank ^ 3u) << rc_smer_shift);
+
+        if (position + 1u < smer_size)
+            continue;
+
+        if (position + 1u < kmer_size)
+        {
+            fwd_smer_values.set(smer_count, fwd_smer);
+            rc_smer_values.set(smer_count, rc_smer);
+            ++smer_count;
+            continue;
+        }
+
+        bool const first_kmer = position + 1u == kmer_size;
+        // Positions of the minima within the previous k-mer.
+        bool const fwd_min_leaves = !first_kmer && fwd_min_index + smers_per_kmer == smer_count;
+        bool const rc_min_is_first = !first_kmer && rc_min_index + 1u == smer_count;
+
+        fwd_smer_values.set(smer_count, fwd_smer);
+        rc_smer_values.set(smer_count, rc_smer);
+        ++smer_count;
+
+        size_t const first_index = smer_count - smers_per_kmer;
+
+        if (first_kmer || fwd_min_leaves)
+        {
+            fwd_smer_values.find_minimum(first_index, smer_count - 1u, fwd_min_value, fwd_min_index);
+        }
+        else if (fwd_smer < fwd_min_value)
+        {
+            fwd_min_value = fwd_smer;
+            fwd_min_index = smer_count - 1u;
+        }
+
+        if (first_kmer || rc_min_is_first)
+        {
+            rc_smer_values.find_minimum(first_index, smer_count - 1u, rc_min_value, rc_min_index);
+        }
+        else if (rc_smer < rc_min_value)
+        {
+            rc_min_value = rc_smer;
+            rc_min_index = smer_count - 1u;
+        }
+
+        if (fwd_kmer <= rc_kmer)
+        {
+            if (offset == fwd_min_index - first_index)
+                hashes.push_back(fwd_kmer);
+        }
+        else if (offset == smer_count - 1u - rc_min_index)
+        {
+            hashes.push_back(rc_kmer);
+        }
+    }
+}
+
+void compute_hashes(std::span<seqan3::dna4 const> const sequence,
+                    hash_parameters const & parameters,
+                    std::vector<uint64_t> & hashes)
+{
+    switch (parameters.hash)
+    {
+    case hash_type::minimiser:
+        return minimiser_hashes(sequence, parameters, hashes);
+    case hash_type::syncmer:
+        return syncmer_hashes(sequence, parameters, hashes);
+    default:
+        throw std::runtime_error{"Invalid hash type."};
+    }
+}
@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include "index_header.hpp"
+
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include <cereal/archives/binary.hpp>
+
+index_header index_header::read(std::istream & stream, std::filesystem::path const & path)
+{
+    index_header header{};
+
+    try
+    {
+        cereal::BinaryInputArchive iarchive{stream};
+        iarchive(header);
+    }
+    catch (cereal::Exception const &)
+    {
+        throw std::runtime_error{path.string() + " is not an index file."};
+    }
+
+    if (header.magic != expected_magic)
+        throw std::runtime_error{path.string() + " is not an index file."};
+    if (header.version != current_version)
+        throw std::runtime_error{path.string() + " has index format version " + std::to_string(header.version)
+                                 + ", but version " + std::to_string(current_version)
+                                 + " is required. Please rebuild the index."};
+
+    return header;
+}
+
+index_header index_header::read(std::filesystem::path const & path)
+{
+    std::ifstream stream{path, std::ios::binary};
+    if (!stream.is_open())
+        throw std::runtime_error{"Could not open " + path.string() + '.'};
+
+    return read(stream, path);
+}
+
+uint64_t index_header::compute_checksum(std::span<char const> const data, uint64_t hash) noexcept
+{
+    for (char const byte : data)
+    {
+        hash ^= static_cast<uint8_t>(byte);
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+checksumming_buffer::checksumming_buffer(std::streambuf & target) : target{target}, buffer(1ULL << 16)
+{
+    setp(buffer.data(), buffer.data() + buffer.size());
+}
+
+checksumming_buffer::~checksumming_buffer()
+{
+    sync();
+}
+
+uint64_t checksumming_buffer::checksum()
+{
+    if (sync() != 0)
+        throw std::runtime_error{"Could not write the index."};
+    return hash;
+}
+
+checksumming_buffer::int_type checksumming_buffer::overflow(int_type const character)
+{
+    if (sync() != 0)
+        return traits_type::eof();
+
+    if (!traits_type::eq_int_type(character, traits_type::eof()))
+    {
+        *pptr() = traits_type::to_char_type(character);
+        pbump(1);
+    }
+    return traits_type::not_eof(character);
+}
+
+int checksumming_buffer::sync()
+{
+    std::span<char const> const data{pbase(), pptr()};
+    hash = index_header::compute_checksum(data, hash);
+    setp(buffer.data(), buffer.data() + buffer.size());
+    return target.sputn(data.data(), data.size()) == static_cast<std::streamsize>(data.size()) ? 0 : -1;
+}
@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include "info/info.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+
+#include "index_header.hpp"
+#include "mapped_file.hpp"
+
+static std::string_view hash_name(hash_type const hash)
+{
+    switch (hash)
+    {
+    case hash_type::minimiser:
+        return "minimiser";
+    case hash_type::syncmer:
+        return "syncmer";
+    default:
+        return "invalid";
+    }
+}
+
+// Only reads the header. The HIBF is not deserialised.
+void info(configuration const & config)
+{
+    index_header const header = index_header::read(config.index_file);
+
+    std::cout << "Format version: " << header.version << '\n'
+              << "Hash: " << hash_name(header.hash) << '\n'
+              << "k-mer size: " << static_cast<uint16_t>(header.kmer_size) << '\n'
+              << "Window size: " << static_cast<uint16_t>(header.window_size) << '\n'
+              << "s: " << static_cast<uint16_t>(header.s) << '\n'
+              << "t: " << static_cast<uint16_t>(header.t) << '\n'
+              << "User bins: " << header.number_of_user_bins << '\n'
+              << "Levels: " << static_cast<uint16_t>(header.number_of_levels) << '\n'
+              << "Compression: " << (header.compression == payload_compression::none ? "none" : "zlib blocks") << '\n';
+
+    size_t const stored_levels = std::min<size_t>(header.number_of_levels, index_header::max_levels);
+    for (size_t level = 0; level < stored_levels; ++level)
+        std::cout << "Bytes on level " << level << ": " << header.bytes_per_level[level] << '\n';
+
+    std::cout << "Checksum: " << std::hex << std::setw(16) << std::setfill('0') << header.checksum << std::dec
+              << std::setfill(' ') << '\n';
+
+    if (config.verify_checksum)
+    {
+        mapped_file const file{config.index_file};
+        if (index_header::compute_checksum(file.data().subspan(header.payload_offset)) != header.checksum)
+            throw std::runtime_error{"Checksum mismatch: " + config.index_file.string() + " is corrupted."};
+
+        std::cout << "Checksum verified.\n";
+    }
+}
@@ -0,0 +1,28 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include "info/run_info.hpp"
+
+#include "configuration.hpp"
+#include "info/info.hpp"
+
+void run_info(sharg::parser & parser)
+{
+    configuration config{};
+
+    parser.add_option(config.index_file,
+                      sharg::config{.short_id = 'i',
+                                    .long_id = "index",
+                                    .description = "HIBF index file to describe.",
+                                    .required = true,
+                                    .validator = sharg::input_file_validator{}});
+
+    parser.add_flag(config.verify_checksum,
+                    sharg::config{.long_id = "verify",
+                                  .description = "Also verify the checksum. This reads the whole index."});
+
+    parser.parse();
+
+    info(config);
+}
@@ -5,7 +5,11 @@
 #include <sharg/all.hpp>
 
 #include "build/run_build.hpp"
+#include "hash/run_hash.hpp"
+#include "info/run_info.hpp"
 #include "search/run_search.hpp"
+#include "serve/run_serve.hpp"
+#include "update/run_update.hpp"
 
 int main(int argc, char ** argv)
 {
@@ -14,7 +18,7 @@ int main(int argc, char ** argv)
                          argc,
                          argv,
                          sharg::update_notifications{sharg::update_notifications::off},
-                         {"build", "search"}};
+                         {"build", "search", "info", "hash", "update", "serve", "client"}};
 
     // General information.
     parser.info.author = "Mariya";
@@ -31,6 +35,16 @@ int main(int argc, char ** argv)
             run_build(sub_parser);
         else if (sub_parser.info.app_name == std::string_view{"HIBF-hashing-search"})
             run_search(sub_parser);
+        else if (sub_parser.info.app_name == std::string_view{"HIBF-hashing-info"})
+            run_info(sub_parser);
+        else if (sub_parser.info.app_name == std::string_view{"HIBF-hashing-hash"})
+            run_hash(sub_parser);
+        else if (sub_parser.info.app_name == std::string_view{"HIBF-hashing-update"})
+            run_update(sub_parser);
+        else if (sub_parser.info.app_name == std::string_view{"HIBF-hashing-serve"})
+            run_serve(sub_parser);
+        else if (sub_parser.info.app_name == std::string_view{"HIBF-hashing-client"})
+            run_client(sub_parser);
     }
     catch (std::exception const & ext)
     {
@@ -0,0 +1,144 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include "run_statistics.hpp"
+
+#include <ctime>
+#include <fstream>
+#include <stdexcept>
+
+#include <sys/resource.h>
+
+run_statistics::scoped_phase::scoped_phase(run_statistics * stats, std::string name) : stats{stats}
+{
+    if (stats == nullptr)
+        return;
+
+    this->name = std::move(name);
+    wall_start = std::chrono::steady_clock::now();
+    cpu_start = process_cpu_seconds();
+}
+
+run_statistics::scoped_phase::~scoped_phase()
+{
+    if (stats == nullptr)
+        return;
+
+    std::chrono::duration<double> const wall = std::chrono::steady_clock::now() - wall_start;
+    stats->add_phase(name, wall.count(), process_cpu_seconds() - cpu_start);
+}
+
+void run_statistics::add_phase(std::string const & name, double const wall_seconds, double const cpu_seconds)
+{
+    std::lock_guard const lock{mutex};
+    timing & phase = phases[name];
+    phase.wall_seconds += wall_seconds;
+    phase.cpu_seconds += cpu_seconds;
+}
+
+void run_statistics::add_thread_phase(std::string const & name, double const seconds)
+{
+    std::lock_guard const lock{mutex};
+    thread_phases[name] += seconds;
+}
+
+void run_statistics::add_counter(std::string const & name, uint64_t const value)
+{
+    std::lock_guard const lock{mutex};
+    counters[name] += value;
+}
+
+void run_statistics::add_distribution(std::string const & name, distribution const & values)
+{
+    std::lock_guard const lock{mutex};
+    distributions[name].merge(values);
+}
+
+void run_statistics::set_list(std::string const & name, std::vector<uint64_t> values)
+{
+    std::lock_guard const lock{mutex};
+    lists[name] = std::move(values);
+}
+
+double run_statistics::process_cpu_seconds() noexcept
+{
+    timespec time{};
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &time);
+    return time.tv_sec + time.tv_nsec * 1e-9;
+}
+
+uint64_t run_statistics::peak_rss_bytes() noexcept
+{
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return static_cast<uint64_t>(usage.ru_maxrss) * 1024u; // ru_maxrss is in KiB on Linux.
+}
+
+// Keys are fixed identifiers and need no escaping.
+void run_statistics::write(std::filesystem::path const & path) const
+{
+    std::lock_guard const lock{mutex};
+    std::ofstream out{path};
+    if (!out.good())
+        throw std::runtime_error{"Could not open " + path.string() + " for writing."};
+
+    auto write_object = [&out](auto const & map, auto && write_value)
+    {
+        out << '{';
+        for (char const * separator = ""; auto const & [name, value] : map)
+        {
+            out << separator << "\n    \"" << name << "\": ";
+            write_value(value);
+            separator = ",";
+        }
+        out << (map.empty() ? "}" : "\n  }");
+    };
+
+    out << "{\n  \"command\": \"" << command << "\",\n  \"phases\": ";
+    write_object(phases,
+                 [&out](timing const & phase)
+                 {
+                     out << "{\"wall_seconds\": " << phase.wall_seconds << ", \"cpu_seconds\": " << phase.cpu_seconds
+                         << '}';
+                 });
+
+    out << ",\n  \"thread_phases\": ";
+    write_object(thread_phases,
+                 [&out](double const seconds)
+                 {
+                     out << "{\"thread_seconds\": " << seconds << '}';
+                 });
+
+    out << ",\n  \"counters\": ";
+    write_object(counters,
+                 [&out](uint64_t const value)
+                 {
+                     out << value;
+                 });
+
+    out << ",\n  \"distributions\": ";
+    write_object(distributions,
+                 [&out](distribution const & values)
+                 {
+                     double const mean = values.count ? static_cast<double>(values.sum) / values.count : 0.0;
+                     out << "{\"count\": " << values.count << ", \"sum\": " << values.sum
+                         << ", \"min\": " << (values.count ? values.min : 0u) << ", \"max\": " << values.max
+                         << ", \"mean\": " << mean << '}';
+                 });
+
+    out << ",\n  \"lists\": ";
+    write_object(lists,
+                 [&out](std::vector<uint64_t> const & values)
+                 {
+                     out << '[';
+                     for (char const * separator = ""; uint64_t const value : values)
+                     {
+                         out << separator << value;
+                         separator = ", ";
+                     }
+                     out << ']';
+                 });
+
+    out << ",\n  \"peak_rss_bytes\": " << peak_rss_bytes() << "\n}\n";
+}
@@ -0,0 +1,133 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include "search/batch_membership_agent.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <tuple>
+#include <utility>
+
+batch_membership_agent::batch_membership_agent(seqan::hibf::hierarchical_interleaved_bloom_filter const & hibf) :
+    hibf{&hibf},
+    agents(hibf.ibf_vector.size()),
+    pending(hibf.ibf_vector.size())
+{
+    if (hibf.ibf_vector.empty())
+        return;
+
+    // Merged bins point to an IBF on the next level, all other bins point to their own IBF.
+    std::vector<bool> visited(hibf.ibf_vector.size());
+    ibf_order.push_back(0u);
+    visited[0] = true;
+
+    for (size_t i = 0; i < ibf_order.size(); ++i)
+    {
+        for (auto const next_ibf_id : hibf.next_ibf_id[ibf_order[i]])
+        {
+            size_t const child = static_cast<size_t>(next_ibf_id);
+            if (!visited[child])
+            {
+                visited[child] = true;
+                ibf_order.push_back(child);
+            }
+        }
+    }
+}
+
+void batch_membership_agent::clear()
+{
+    hashes.clear();
+    hash_offsets.resize(1u);
+    thresholds.clear();
+}
+
+void batch_membership_agent::add(std::span<uint64_t const> const read_hashes, uint16_t const threshold)
+{
+    hashes.insert(hashes.end(), read_hashes.begin(), read_hashes.end());
+    hash_offsets.push_back(hashes.size());
+    thresholds.push_back(threshold);
+}
+
+void batch_membership_agent::query()
+{
+    results.resize(size());
+    for (auto & result : results)
+        result.clear();
+    result_counts.resize(size());
+    for (auto & result : result_counts)
+        result.clear();
+
+    if (ibf_order.empty())
+        return;
+
+    pending[0].resize(size());
+    std::iota(pending[0].begin(), pending[0].end(), 0u);
+
+    for (size_t const ibf_id : ibf_order)
+    {
+        if (pending[ibf_id].empty())
+            continue;
+
+        if (!agents[ibf_id])
+            agents[ibf_id].emplace(hibf->ibf_vector[ibf_id].counting_agent<uint16_t>());
+
+        auto const & user_bin_ids = hibf->ibf_bin_to_user_bin_id[ibf_id];
+        auto const & next_ibf_ids = hibf->next_ibf_id[ibf_id];
+
+        for (uint32_t const read : pending[ibf_id])
+        {
+            std::span<uint64_t const> const read_hashes{hashes.data() + hash_offsets[read],
+                                                        hashes.data() + hash_offsets[read + 1u]};
+            auto const & counts = agents[ibf_id]->bulk_count(read_hashes);
+            uint16_t const threshold = thresholds[read];
+
+            // Same traversal as the HIBF's membership agent: split bins are summed up, merged bins are descended into.
+            size_t sum{};
+            for (size_t bin = 0; bin < counts.size(); ++bin)
+            {
+                sum += counts[bin];
+                // Merged bins are -1 if the HIBF stores int64_t, and special values at the top of uint64_t otherwise.
+                // Both are negative as int64_t.
+                int64_t const user_bin_id = static_cast<int64_t>(user_bin_ids[bin]);
+
+                if (user_bin_id < 0)
+                {
+                    // Deleted bins point to their own IBF and have nothing to descend into.
+                    size_t const child = static_cast<size_t>(next_ibf_ids[bin]);
+                    if (sum >= threshold && child != ibf_id)
+                        pending[child].push_back(read);
+                    sum = 0u;
+                }
+                else if (bin + 1u == counts.size() || user_bin_id != static_cast<int64_t>(user_bin_ids[bin + 1u]))
+                {
+                    if (sum >= threshold)
+                    {
+                        results[read].push_back(static_cast<uint64_t>(user_bin_id));
+                        result_counts[read].push_back(static_cast<uint32_t>(sum));
+                    }
+                    sum = 0u;
+                }
+            }
+        }
+
+        pending[ibf_id].clear();
+    }
+
+    // Results are collected level by level. Sort them by user bin and keep each count with its user bin.
+    std::vector<std::pair<uint64_t, uint32_t>> hits;
+    for (size_t read = 0; read < results.size(); ++read)
+    {
+        if (std::ranges::is_sorted(results[read]))
+            continue;
+
+        hits.clear();
+        for (size_t i = 0; i < results[read].size(); ++i)
+            hits.emplace_back(results[read][i], result_counts[read][i]);
+        std::ranges::sort(hits);
+
+        for (size_t i = 0; i < hits.size(); ++i)
+            std::tie(results[read][i], result_counts[read][i]) = hits[i];
+    }
+}
@@ -0,0 +1,119 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include "search/result_format.hpp"
+
+#include <array>
+#include <charconv>
+#include <limits>
+
+namespace
+{
+
+void append_number(std::string & out, uint64_t const value)
+{
+    std::array<char, std::numeric_limits<uint64_t>::digits10 + 1> buffer{};
+    auto const conv = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+    out.append(buffer.data(), conv.ptr);
+}
+
+void append_list(std::string & out, std::span<uint64_t const> const values)
+{
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        if (i != 0u)
+            out += ',';
+        append_number(out, values[i]);
+    }
+}
+
+} // namespace
+
+void append_result(std::string & out,
+                   result_format const format,
+                   std::string_view const id,
+                   uint64_t const read_index,
+                   std::span<uint64_t const> const user_bins)
+{
+    switch (format)
+    {
+    case result_format::text:
+        out += id;
+        out += ": [";
+        append_list(out, user_bins);
+        out += "]\n";
+        break;
+    case result_format::tsv:
+        for (uint64_t const user_bin : user_bins)
+        {
+            out += id;
+            out += '\t';
+            append_number(out, user_bin);
+            out += '\n';
+        }
+        break;
+    case result_format::binary:
+        append_varint(out, read_index);
+        append_varint(out, user_bins.size());
+        for (uint64_t const user_bin : user_bins)
+            append_varint(out, user_bin);
+        break;
+    }
+}
+
+void append_count_result(std::string & out,
+                         result_format const format,
+                         std::string_view const id,
+                         uint64_t const read_index,
+                         count_result const & result)
+{
+    switch (format)
+    {
+    case result_format::text:
+        out += id;
+        out += ": ";
+        append_number(out, result.hash_count);
+        out += " hashes, thresholds [";
+        append_list(out, result.thresholds);
+        out += "], counts [";
+        for (size_t i = 0; i < result.user_bins.size(); ++i)
+        {
+            if (i != 0u)
+                out += ',';
+            append_number(out, result.user_bins[i]);
+            out += ':';
+            append_number(out, result.counts[i]);
+        }
+        out += "]\n";
+        break;
+    case result_format::tsv:
+        for (size_t i = 0; i < result.user_bins.size(); ++i)
+        {
+            out += id;
+            out += '\t';
+            append_number(out, result.user_bins[i]);
+            out += '\t';
+            append_number(out, result.counts[i]);
+            out += '\t';
+            append_number(out, result.hash_count);
+            out += '\t';
+            append_list(out, result.thresholds);
+            out += '\n';
+        }
+        break;
+    case result_format::binary:
+        append_varint(out, read_index);
+        append_varint(out, result.hash_count);
+        append_varint(out, result.thresholds.size());
+        for (uint64_t const threshold : result.thresholds)
+            append_varint(out, threshold);
+        append_varint(out, result.user_bins.size());
+        for (size_t i = 0; i < result.user_bins.size(); ++i)
+        {
+            append_varint(out, result.user_bins[i]);
+            append_varint(out, result.counts[i]);
+        }
+        break;
+    }
+}
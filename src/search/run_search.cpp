@@ -7,6 +7,25 @@
 #include "configuration.hpp"
 #include "search/search.hpp"
 
+// Accepts `-` for standard input and named pipes, which input_file_validator would open and thus consume.
+struct reads_validator
+{
+    using option_value_type = std::string;
+
+    void operator()(std::filesystem::path const & path) const
+    {
+        if (path == "-" || std::filesystem::is_fifo(path))
+            return;
+
+        sharg::input_file_validator{}(path);
+    }
+
+    std::string get_help_page_message() const
+    {
+        return "Write - to read from standard input. Named pipes are read once, front to back.";
+    }
+};
+
 void run_search(sharg::parser & parser)
 {
     configuration config{};
@@ -21,9 +40,9 @@ void run_search(sharg::parser & parser)
     parser.add_option(config.reads,
                       sharg::config{.short_id = 'r',
                                     .long_id = "reads",
-                                    .description = "reads to search for.",
+                                    .description = "reads to search for. FASTA or FASTQ.",
                                     .required = true,
-                                    .validator = sharg::input_file_validator{}});
+                                    .validator = reads_validator{}});
 
     parser.add_option(config.error,
                       sharg::config{.short_id = 'e',
@@ -35,10 +54,53 @@ void run_search(sharg::parser & parser)
         config.search_output,
         sharg::config{.short_id = 'o',
                       .long_id = "output",
-                      .description = ".txt file to write the search results to.",
+                      .description = "File to write the search results to.",
                       .validator = sharg::output_file_validator{sharg::output_file_open_options::open_or_create}});
 
+    std::string format{"text"};
+    parser.add_option(format,
+                      sharg::config{.long_id = "format",
+                                    .description = "Output format. text: \"id: [0,1]\" per read. tsv: "
+                                                   "\"id<TAB>user bin\" per hit. binary: a header (\"HIBFRES\", "
+                                                   "version, and flags; one byte each), then read index, number of "
+                                                   "user bins, and user bins per read, all as varints.",
+                                    .validator = sharg::value_list_validator{"text", "tsv", "binary"}});
+
+    parser.add_flag(config.count_hashes,
+                    sharg::config{.long_id = "counts",
+                                  .description = "Report how many hashes of a read each user bin contains, the read's "
+                                                 "number of hashes, and its thresholds for 0 to --error errors. Lists "
+                                                 "all user bins that are reported for --error or fewer errors, so "
+                                                 "several error levels can be evaluated from one search."});
+
+    parser.add_flag(config.print_results,
+                    sharg::config{.long_id = "print_results",
+                                  .description = "Also print the search results to the standard output."});
+
+    parser.add_option(config.threads,
+                      sharg::config{.long_id = "threads",
+                                    .description = "The number of threads to use.",
+                                    .validator = sharg::arithmetic_range_validator{1, 1024}});
+
+    parser.add_option(config.threshold_cache,
+                      sharg::config{.long_id = "threshold_cache",
+                                    .description = "Directory to store precomputed thresholds in and load them from, "
+                                                   "e.g., the directory of the index. Created if it does not exist."});
+
+    parser.add_option(config.stats_output,
+                      sharg::config{.long_id = "stats",
+                                    .description = "Write the time per phase, counters, and peak memory as JSON to "
+                                                   "this file."});
+
     parser.parse();
 
+    if (format == "tsv")
+        config.output_format = result_format::tsv;
+    else if (format == "binary")
+        config.output_format = result_format::binary;
+
+    if (config.print_results && config.output_format == result_format::binary)
+        throw sharg::validation_error{"--print_results cannot be combined with --format binary."};
+
     search(config);
 }
@@ -4,104 +4,176 @@
 
 #include "search/search.hpp"
 
-#include <iostream>
+#include <fstream>
+#include <optional>
 
-#include <seqan3/io/sequence_file/all.hpp>
-#include <seqan3/search/views/minimiser_hash.hpp>
+#include <seqan3/utility/views/chunk.hpp>
 
-#include "contrib/syncmer.hpp"
-#include "dna4_traits.hpp"
+#include "do_parallel.hpp"
 #include "index_data.hpp"
-#include <cereal/archives/binary.hpp>
-#include <hibf/config.hpp>
-#include <hibf/hierarchical_interleaved_bloom_filter.hpp>
-#include <threshold/threshold.hpp>
+#include "run_statistics.hpp"
+#include "search/result_format.hpp"
 
-threshold::threshold get_thresholder(configuration const & config, myindex const & index)
+// The number of records each thread processes per batch.
+static constexpr size_t records_per_thread{1ULL << 12};
+
+reads_file_t open_reads(std::istream & stream)
 {
-    size_t const first_sequence_size = [&]()
+    switch (stream.peek())
     {
-        seqan3::sequence_file_input<dna4_traits> fin{config.reads};
-        auto & record = *fin.begin();
-        return record.sequence().size();
-    }();
-
-    return {threshold::threshold_parameters{.window_size = index.window_size,
-                                            .shape = seqan3::ungapped{index.kmer_size},
-                                            .query_length = first_sequence_size,
-                                            .errors = config.error}};
+    case '@':
+        return reads_file_t{stream, seqan3::format_fastq{}};
+    case '>':
+    case std::char_traits<char>::eof(): // No records.
+        return reads_file_t{stream, seqan3::format_fasta{}};
+    default:
+        throw std::runtime_error{"The reads are neither FASTA nor FASTQ."};
+    }
 }
 
-void search(configuration const & config)
+size_t search_reads(searcher const & index_searcher,
+                    reads_file_t & reads,
+                    result_writer & writer,
+                    result_format const format,
+                    bool const counts,
+                    size_t const threads,
+                    run_statistics * const stats_report)
 {
-    myindex index{};
-    index.load(config.index_file);
-    auto agent = index.hibf.membership_agent();
+    using record_t = typename reads_file_t::record_type;
 
-    std::vector<std::string> results;
-    std::string result_line{};
-    std::array<char, std::numeric_limits<uint64_t>::digits10 + 1> buffer{};
-    std::vector<uint64_t> hashes;
+    std::vector<record_t> records;
+    std::vector<std::string> batch_results;
+    size_t number_of_records{};
+    size_t first_record{}; // Index of the first record of the current batch.
 
-    threshold::threshold const thresholder = get_thresholder(config, index);
-    auto get_results = [&](auto & record)
+    // Each worker queries a contiguous part of the current batch at once and formats the results in `format`.
+    // Results are written to the slot of the respective record, so the output order equals the input order.
+    // With `--stats`, each worker times its phases locally and reports once per batch.
+    auto worker = [&](size_t const start, size_t const extent)
     {
-        auto & result = agent.membership_for(hashes, thresholder.get(hashes.size()));
-        agent.sort_results();
+        std::vector<std::span<seqan3::dna4 const>> sequences;
+        std::vector<std::vector<uint64_t>> bins;
+        std::vector<count_result> bin_counts;
 
-        result_line.clear();
-        result_line += record.id() + ": [";
+        sequences.reserve(extent);
+        for (size_t i = start; i < start + extent; ++i)
+            sequences.emplace_back(records[i].sequence());
 
-        for (auto && bin : result)
-        {
-            auto conv = std::to_chars(buffer.data(), buffer.data() + buffer.size(), bin);
-            assert(conv.ec == std::errc{});
-            std::string_view sv{buffer.data(), conv.ptr};
-            result_line += sv;
-            result_line += ',';
-        }
+        if (counts)
+            index_searcher.count_batch(sequences, bin_counts, stats_report);
+        else
+            index_searcher.query_batch(sequences, bins, stats_report);
 
-        if (result_line.back() == ',')
-            result_line.pop_back();
+        lap_clock clock{};
+        distribution hits_per_read{};
 
-        result_line += "]\n";
+        for (size_t i = start; i < start + extent; ++i)
+        {
+            std::string & result = batch_results[i];
+            result.clear();
+
+            if (counts)
+            {
+                append_count_result(result, format, records[i].id(), first_record + i, bin_counts[i - start]);
+                hits_per_read.add(bin_counts[i - start].user_bins.size());
+            }
+            else
+            {
+                append_result(result, format, records[i].id(), first_record + i, bins[i - start]);
+                hits_per_read.add(bins[i - start].size());
+            }
+        }
 
-        // store the result in the vector
-        results.push_back(result_line);
+        if (stats_report != nullptr)
+        {
+            stats_report->add_thread_phase("format", clock.lap());
+            stats_report->add_counter("reads", extent);
+            stats_report->add_distribution("hits_per_read", hits_per_read);
+        }
     };
 
-    seqan3::sequence_file_input<dna4_traits> reads_file{config.reads};
-    auto process = [&](auto hash_adaptor)
+    for (auto && record_batch : reads | seqan3::views::chunk(records_per_thread * threads))
     {
-        for (auto & record : reads_file)
         {
-            auto view = record.sequence() | hash_adaptor | std::views::common;
-            hashes.clear();
-            hashes.assign(view.begin(), view.end());
-            get_results(record);
+            run_statistics::scoped_phase const phase{stats_report, "parse"};
+            first_record = number_of_records;
+            records.clear();
+            std::ranges::move(record_batch, std::back_inserter(records));
+            batch_results.resize(records.size());
+            number_of_records += records.size();
+        }
+
+        {
+            run_statistics::scoped_phase const phase{stats_report, "query"};
+            do_parallel(worker, records.size(), threads);
         }
-    };
 
-    if (index.hash != hash_type::syncmer)
+        // write the results in input order
+        run_statistics::scoped_phase const phase{stats_report, "write"};
+        for (std::string const & result_line : batch_results)
+            writer.write(result_line);
+    }
+
+    return number_of_records;
+}
+
+void search(configuration const & config)
+{
+    std::optional<run_statistics> report{};
+    if (!config.stats_output.empty())
+        report.emplace("search");
+    run_statistics * const stats_report = report ? &*report : nullptr;
+
+    myindex index{};
     {
-        process(
-            seqan3::views::minimiser_hash(seqan3::ungapped{index.kmer_size}, seqan3::window_size{index.window_size}));
+        run_statistics::scoped_phase const phase{stats_report, "load"};
+        index.load(config.index_file, config.threads);
     }
-    else
+
+    std::optional<searcher> index_searcher{};
     {
-        process(seqan3::views::syncmer({.kmer_size = index.kmer_size, .smer_size = index.s, .offset = index.t}));
+        run_statistics::scoped_phase const phase{stats_report, "threshold_setup"};
+        index_searcher.emplace(std::move(index), config);
     }
 
-    std::cout << "The following hits were found:\n";
-    //print to console
-    for (auto & record : results)
     {
-        std::cout << record;
+        // Standard input has no extension to derive the format from. Named pipes are opened like files.
+        bool const from_stdin = config.reads == "-";
+        std::ifstream stdin_stream{};
+        if (from_stdin)
+            stdin_stream.open("/dev/stdin", std::ios::binary);
+
+        result_writer writer{config.search_output, config.print_results};
+        if (config.output_format == result_format::binary)
+        {
+            std::string header;
+            append_binary_header(header,
+                                 {.flags = config.count_hashes ? binary_result_header::counts_flag : uint8_t{}});
+            writer.write(header);
+        }
+
+        reads_file_t reads = from_stdin ? open_reads(stdin_stream) : reads_file_t{config.reads};
+        search_reads(*index_searcher,
+                     reads,
+                     writer,
+                     config.output_format,
+                     config.count_hashes,
+                     config.threads,
+                     stats_report);
+
+        run_statistics::scoped_phase const phase{stats_report, "write"};
+        writer.flush();
     }
-    //save to file
-    std::ofstream result_out{config.search_output};
-    for (auto & record : results)
+
+    if (report)
     {
-        result_out << record;
+        // The size of streamed reads is unknown.
+        uint64_t bytes_read = std::filesystem::file_size(config.index_file);
+        if (std::filesystem::is_regular_file(config.reads))
+            bytes_read += std::filesystem::file_size(config.reads);
+
+        report->add_counter("bytes_read", bytes_read);
+        report->add_counter("bytes_written", std::filesystem::file_size(config.search_output));
+        report->write(config.stats_output);
     }
 }
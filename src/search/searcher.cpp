@@ -0,0 +1,173 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include "search/searcher.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace
+{
+
+myindex load_index(configuration const & config)
+{
+    myindex index{};
+    index.load(config.index_file, config.threads);
+    return index;
+}
+
+} // namespace
+
+searcher::searcher(configuration const & config) : searcher{load_index(config), config}
+{}
+
+searcher::searcher(myindex index, configuration const & config) :
+    hibf_index{std::move(index)},
+    thresholds{config, hibf_index},
+    // Indexes without a hash type predate syncmers and use minimisers.
+    parameters{.hash = (hibf_index.hash == hash_type::syncmer) ? hash_type::syncmer : hash_type::minimiser,
+               .kmer_size = hibf_index.kmer_size,
+               .window_size = hibf_index.window_size,
+               .s = hibf_index.s,
+               .t = hibf_index.t}
+{
+    // `count` also reports the thresholds for fewer errors. They are computed lazily, like `thresholds`.
+    configuration level_config = config;
+    for (uint8_t errors = 0; errors < config.error; ++errors)
+    {
+        level_config.error = errors;
+        level_thresholds.push_back(std::make_unique<thresholder>(level_config, hibf_index));
+    }
+}
+
+template <typename collect_t>
+void searcher::search_batch(std::span<std::span<seqan3::dna4 const> const> const sequences,
+                            run_statistics * const stats,
+                            collect_t && collect) const
+{
+    std::unique_ptr<workspace> space = acquire();
+    batch_membership_agent & agent = space->agent;
+    std::vector<uint64_t> & hashes = space->hashes;
+
+    lap_clock clock{};
+    uint64_t bases{};
+    distribution hashes_per_read{};
+
+    agent.clear();
+    for (std::span<seqan3::dna4 const> const sequence : sequences)
+    {
+        compute_hashes(sequence, parameters, hashes);
+        // The agent counts with 16 bit; a larger threshold must not wrap around to a small one.
+        size_t const threshold = std::min<size_t>(thresholds.get(sequence.size(), hashes.size()), UINT16_MAX);
+        agent.add(hashes, static_cast<uint16_t>(threshold));
+
+        if (stats != nullptr)
+        {
+            bases += sequence.size();
+            hashes_per_read.add(hashes.size());
+        }
+    }
+
+    if (stats != nullptr)
+        stats->add_thread_phase("hash", clock.lap());
+
+    agent.query();
+    collect(agent);
+
+    if (stats != nullptr)
+    {
+        stats->add_thread_phase("membership", clock.lap());
+        stats->add_counter("bases", bases);
+        stats->add_distribution("hashes_per_read", hashes_per_read);
+    }
+
+    release(std::move(space));
+}
+
+std::vector<uint64_t> searcher::query(std::span<seqan3::dna4 const> const sequence) const
+{
+    std::vector<std::vector<uint64_t>> results;
+    query_batch({&sequence, 1u}, results);
+    return std::move(results[0]);
+}
+
+void searcher::query_batch(std::span<std::span<seqan3::dna4 const> const> const sequences,
+                           std::vector<std::vector<uint64_t>> & results,
+                           run_statistics * const stats) const
+{
+    search_batch(sequences,
+                 stats,
+                 [&](batch_membership_agent const & agent)
+                 {
+                     results.resize(sequences.size());
+                     for (size_t i = 0; i < sequences.size(); ++i)
+                     {
+                         results[i].clear();
+                         for (uint64_t const bin : agent.result(i))
+                             if (!hibf_index.is_removed(bin))
+                                 results[i].push_back(bin);
+                     }
+                 });
+}
+
+count_result searcher::count(std::span<seqan3::dna4 const> const sequence) const
+{
+    std::vector<count_result> results;
+    count_batch({&sequence, 1u}, results);
+    return std::move(results[0]);
+}
+
+void searcher::count_batch(std::span<std::span<seqan3::dna4 const> const> const sequences,
+                           std::vector<count_result> & results,
+                           run_statistics * const stats) const
+{
+    search_batch(sequences,
+                 stats,
+                 [&](batch_membership_agent const & agent)
+                 {
+                     results.resize(sequences.size());
+                     for (size_t i = 0; i < sequences.size(); ++i)
+                     {
+                         count_result & result = results[i];
+                         result.hash_count = agent.hash_count(i);
+                         result.thresholds.clear();
+                         for (std::unique_ptr<thresholder> const & level : level_thresholds)
+                             result.thresholds.push_back(level->get(sequences[i].size(), result.hash_count));
+                         result.thresholds.push_back(thresholds.get(sequences[i].size(), result.hash_count));
+                         result.user_bins.clear();
+                         result.counts.clear();
+
+                         std::span<uint64_t const> const bins = agent.result(i);
+                         std::span<uint32_t const> const counts = agent.counts(i);
+                         for (size_t j = 0; j < bins.size(); ++j)
+                         {
+                             if (hibf_index.is_removed(bins[j]))
+                                 continue;
+                             result.user_bins.push_back(bins[j]);
+                             result.counts.push_back(counts[j]);
+                         }
+                     }
+                 });
+}
+
+std::unique_ptr<searcher::workspace> searcher::acquire() const
+{
+    {
+        std::lock_guard const lock{pool_mutex};
+        if (!pool.empty())
+        {
+            std::unique_ptr<workspace> space = std::move(pool.back());
+            pool.pop_back();
+            return space;
+        }
+    }
+
+    return std::make_unique<workspace>(hibf_index);
+}
+
+void searcher::release(std::unique_ptr<workspace> space) const
+{
+    std::lock_guard const lock{pool_mutex};
+    pool.push_back(std::move(space));
+}
@@ -0,0 +1,96 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include "search/thresholder.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <exception>
+#include <mutex>
+
+thresholder::thresholder(configuration const & config, myindex const & index) :
+    kmer_size{index.kmer_size},
+    window_size{index.window_size},
+    errors{config.error},
+    threshold_cache{config.threshold_cache}
+{
+    // Syncmer indexes carry their own threshold model. The minimiser model assumes a window, which syncmers lack.
+    if (index.hash == hash_type::syncmer)
+        syncmer_model = &index.syncmer_model;
+
+    if (!threshold_cache.empty())
+        std::filesystem::create_directories(threshold_cache);
+}
+
+size_t thresholder::get(size_t const query_length, size_t const hash_count) const
+{
+    // A user bin must contain at least one hash. Otherwise, a read without hashes would be found in every user bin.
+    if (syncmer_model != nullptr)
+        return std::max<size_t>(syncmer_model->get(hash_count, errors), 1u);
+
+    // The models need at least one full window. Shorter reads have at most a handful of hashes.
+    if (query_length < window_size)
+        return errors == 0u ? std::max<size_t>(hash_count, 1u) : 1u;
+
+    return std::max<size_t>(threshold_for(query_length).get(hash_count), 1u);
+}
+
+size_t thresholder::length_bucket(size_t const query_length) noexcept
+{
+    // Exact up to 256, then 128 buckets per power of two.
+    if (query_length <= 256u)
+        return query_length;
+
+    int const shift = std::bit_width(query_length) - 8;
+    return (query_length >> shift) << shift;
+}
+
+threshold::threshold const & thresholder::threshold_for(size_t const query_length) const
+{
+    size_t const length = length_bucket(query_length);
+
+    {
+        std::shared_lock lock{mutex};
+        if (auto it = thresholds.find(length); it != thresholds.end())
+            return it->second.get();
+    }
+
+    // The first thread to see a length computes its threshold. Computing a table takes long, so other lengths must
+    // not wait for it.
+    std::promise<threshold::threshold> promise{};
+    std::shared_future<threshold::threshold> result{};
+    bool compute{false};
+    {
+        std::unique_lock lock{mutex};
+        auto [it, inserted] = thresholds.try_emplace(length);
+        if (inserted)
+        {
+            it->second = promise.get_future().share();
+            compute = true;
+        }
+        result = it->second;
+    }
+
+    if (compute)
+    {
+        try
+        {
+            // The threshold library keys cached tables by query length, window, shape, errors, and tau.
+            promise.set_value(threshold::threshold{
+                threshold::threshold_parameters{.window_size = window_size,
+                                                .shape = seqan3::ungapped{kmer_size},
+                                                .query_length = length,
+                                                .errors = errors,
+                                                .cache_thresholds = !threshold_cache.empty(),
+                                                .output_directory = threshold_cache}});
+        }
+        catch (...)
+        {
+            promise.set_exception(std::current_exception());
+        }
+    }
+
+    // The future in the map shares the state with `result`, so the reference outlives `result`.
+    return result.get();
+}
@@ -0,0 +1,234 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include "serve/protocol.hpp"
+
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace
+{
+
+std::runtime_error system_error(std::string const & what)
+{
+    return std::runtime_error{what + ": " + std::strerror(errno)};
+}
+
+sockaddr_un socket_address(std::filesystem::path const & path)
+{
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+
+    std::string const name = path.string();
+    if (name.size() >= sizeof(address.sun_path))
+        throw std::runtime_error{"The socket path " + name + " is too long."};
+
+    std::memcpy(address.sun_path, name.data(), name.size());
+    return address;
+}
+
+// A peer that went away must not raise SIGPIPE. Linux has a flag for each send, BSDs and macOS a socket option.
+#ifdef MSG_NOSIGNAL
+constexpr int send_flags{MSG_NOSIGNAL};
+#else
+constexpr int send_flags{0};
+#endif
+
+void suppress_sigpipe([[maybe_unused]] int const fd)
+{
+#ifdef SO_NOSIGPIPE
+    int const enable{1};
+    ::setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &enable, sizeof(enable));
+#endif
+}
+
+void set_blocking(int const fd, bool const blocking)
+{
+    int const flags = ::fcntl(fd, F_GETFL);
+    if (flags == -1 || ::fcntl(fd, F_SETFL, blocking ? (flags & ~O_NONBLOCK) : (flags | O_NONBLOCK)) == -1)
+        throw system_error("Could not configure socket");
+}
+
+void send_all(int const fd, char const * data, size_t size)
+{
+    while (size > 0u)
+    {
+        ssize_t const sent = ::send(fd, data, size, send_flags);
+        if (sent < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            throw system_error("Could not send to socket");
+        }
+        data += sent;
+        size -= static_cast<size_t>(sent);
+    }
+}
+
+// Returns the number of bytes read, which is only less than `size` if the connection was closed.
+size_t receive_all(int const fd, char * data, size_t const size)
+{
+    size_t received{};
+    while (received < size)
+    {
+        ssize_t const count = ::recv(fd, data + received, size - received, 0);
+        if (count < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+                throw receive_timeout{"Timed out waiting for the peer."};
+            throw system_error("Could not receive from socket");
+        }
+        if (count == 0)
+            break;
+        received += static_cast<size_t>(count);
+    }
+    return received;
+}
+
+} // namespace
+
+unix_socket::unix_socket(unix_socket && other) noexcept : fd{std::exchange(other.fd, -1)}
+{}
+
+unix_socket & unix_socket::operator=(unix_socket && other) noexcept
+{
+    if (this != &other)
+    {
+        if (valid())
+            ::close(fd);
+        fd = std::exchange(other.fd, -1);
+    }
+    return *this;
+}
+
+unix_socket::~unix_socket()
+{
+    if (valid())
+        ::close(fd);
+}
+
+unix_socket unix_socket::listen(std::filesystem::path const & path)
+{
+    sockaddr_un const address = socket_address(path);
+
+    unix_socket socket{::socket(AF_UNIX, SOCK_STREAM, 0)};
+    if (!socket.valid())
+        throw system_error("Could not create socket");
+
+    if (std::filesystem::is_socket(path))
+        std::filesystem::remove(path);
+
+    if (::bind(socket.fd, reinterpret_cast<sockaddr const *>(&address), sizeof(address)) != 0)
+        throw system_error("Could not bind to " + path.string());
+
+    if (::listen(socket.fd, SOMAXCONN) != 0)
+        throw system_error("Could not listen on " + path.string());
+
+    set_blocking(socket.fd, false);
+    return socket;
+}
+
+unix_socket unix_socket::connect(std::filesystem::path const & path)
+{
+    sockaddr_un const address = socket_address(path);
+
+    unix_socket socket{::socket(AF_UNIX, SOCK_STREAM, 0)};
+    if (!socket.valid())
+        throw system_error("Could not create socket");
+
+    if (::connect(socket.fd, reinterpret_cast<sockaddr const *>(&address), sizeof(address)) != 0)
+        throw system_error("Could not connect to " + path.string());
+
+    suppress_sigpipe(socket.fd);
+    return socket;
+}
+
+std::pair<unix_socket, unix_socket> unix_socket::pair()
+{
+    int fds[2];
+    if (::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0)
+        throw system_error("Could not create socket pair");
+
+    std::pair<unix_socket, unix_socket> sockets{unix_socket{fds[0]}, unix_socket{fds[1]}};
+    suppress_sigpipe(fds[0]);
+    suppress_sigpipe(fds[1]);
+    return sockets;
+}
+
+unix_socket unix_socket::accept() const
+{
+    while (true)
+    {
+        int const connection = ::accept(fd, nullptr, nullptr);
+        if (connection != -1)
+        {
+            // Some systems pass O_NONBLOCK of the listening socket on.
+            unix_socket socket{connection};
+            set_blocking(connection, true);
+            suppress_sigpipe(connection);
+            return socket;
+        }
+        if (errno == EINTR)
+            continue;
+        if (errno == EAGAIN || errno == EWOULDBLOCK || errno == ECONNABORTED)
+            return unix_socket{};
+        throw system_error("Could not accept connection");
+    }
+}
+
+void unix_socket::set_receive_timeout(uint32_t const seconds) const
+{
+    timeval const timeout{.tv_sec = static_cast<time_t>(seconds), .tv_usec = 0};
+    if (::setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout)) != 0)
+        throw system_error("Could not set the receive timeout");
+}
+
+void write_message(int const fd, message_type const type, std::string_view const payload)
+{
+    std::array<char, 9> header{};
+    header[0] = static_cast<char>(type);
+    uint64_t const size = payload.size();
+    for (size_t i = 0; i < 8u; ++i)
+        header[i + 1u] = static_cast<char>((size >> (8u * i)) & 0xFFu);
+
+    send_all(fd, header.data(), header.size());
+    send_all(fd, payload.data(), payload.size());
+}
+
+bool read_message(int const fd, message & msg, uint64_t const max_payload_size)
+{
+    std::array<char, 9> header{};
+    size_t const received = receive_all(fd, header.data(), header.size());
+    if (received == 0u)
+        return false;
+    if (received != header.size())
+        throw std::runtime_error{"Connection closed within a message header."};
+
+    uint64_t size{};
+    for (size_t i = 0; i < 8u; ++i)
+        size |= static_cast<uint64_t>(static_cast<uint8_t>(header[i + 1u])) << (8u * i);
+
+    if (size > max_payload_size)
+        throw message_too_large{"The message has " + std::to_string(size) + " bytes, more than the limit of "
+                                + std::to_string(max_payload_size) + " bytes."};
+
+    msg.type = static_cast<message_type>(header[0]);
+    msg.payload.resize(size);
+    if (receive_all(fd, msg.payload.data(), size) != size)
+        throw std::runtime_error{"Connection closed within a message."};
+
+    return true;
+}
@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include "serve/run_serve.hpp"
+
+#include "configuration.hpp"
+#include "serve/serve.hpp"
+
+void run_serve(sharg::parser & parser)
+{
+    configuration config{};
+
+    parser.add_option(config.index_file,
+                      sharg::config{.short_id = 'i',
+                                    .long_id = "index",
+                                    .description = "HIBF index file to load.",
+                                    .required = true,
+                                    .validator = sharg::input_file_validator{}});
+
+    parser.add_option(config.socket_path,
+                      sharg::config{.short_id = 's',
+                                    .long_id = "socket",
+                                    .description = "Unix domain socket to listen on. An existing socket is replaced."});
+
+    parser.add_option(config.error,
+                      sharg::config{.short_id = 'e',
+                                    .long_id = "error",
+                                    .description = "The maximum number of errors allowed. Applies to all requests.",
+                                    .validator = sharg::arithmetic_range_validator{0, 5}});
+
+    parser.add_option(config.threads,
+                      sharg::config{.long_id = "threads",
+                                    .description = "The number of requests to answer in parallel.",
+                                    .validator = sharg::arithmetic_range_validator{1, 1024}});
+
+    parser.add_option(config.max_request_size,
+                      sharg::config{.long_id = "max_request_size",
+                                    .description = "Reject requests larger than this many MiB.",
+                                    .validator = sharg::arithmetic_range_validator{1, 1048576}});
+
+    parser.add_option(config.idle_timeout,
+                      sharg::config{.long_id = "idle_timeout",
+                                    .description = "Close connections on which a client sends nothing for this many "
+                                                   "seconds. 0 means no timeout."});
+
+    parser.add_option(config.threshold_cache,
+                      sharg::config{.long_id = "threshold_cache",
+                                    .description = "Directory to store precomputed thresholds in and load them from, "
+                                                   "e.g., the directory of the index. Created if it does not exist."});
+
+    parser.parse();
+
+    serve(config);
+}
+
+void run_client(sharg::parser & parser)
+{
+    configuration config{};
+
+    parser.add_option(config.socket_path,
+                      sharg::config{.short_id = 's',
+                                    .long_id = "socket",
+                                    .description = "Unix domain socket of a running server."});
+
+    parser.add_option(config.reads,
+                      sharg::config{.short_id = 'r',
+                                    .long_id = "reads",
+                                    .description = "Uncompressed FASTA or FASTQ file with the reads to search for.",
+                                    .validator = sharg::input_file_validator{}});
+
+    parser.add_option(
+        config.search_output,
+        sharg::config{.short_id = 'o',
+                      .long_id = "output",
+                      .description = ".txt file to write the search results to.",
+                      .validator = sharg::output_file_validator{sharg::output_file_open_options::open_or_create}});
+
+    parser.add_flag(config.print_results,
+                    sharg::config{.long_id = "print_results",
+                                  .description = "Also print the search results to the standard output."});
+
+    parser.add_flag(config.shutdown_server,
+                    sharg::config{.long_id = "shutdown", .description = "Stop the server instead of searching."});
+
+    parser.parse();
+
+    if (!config.shutdown_server && config.reads.empty())
+        throw sharg::validation_error{"Either --reads or --shutdown is required."};
+
+    client(config);
+}
@@ -0,0 +1,296 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include "serve/serve.hpp"
+
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <mutex>
+#include <queue>
+#include <sstream>
+#include <thread>
+#include <tuple>
+#include <unordered_set>
+#include <vector>
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "mapped_file.hpp"
+#include "run_statistics.hpp"
+#include "search/result_writer.hpp"
+#include "search/search.hpp"
+#include "search/searcher.hpp"
+#include "serve/protocol.hpp"
+
+namespace
+{
+
+// Searches the FASTA or FASTQ records of a request and returns the result lines.
+std::string search_request(searcher const & index_searcher, std::string const & payload, size_t & number_of_records)
+{
+    number_of_records = 0u;
+    if (payload.empty())
+        return {};
+
+    std::istringstream input{payload};
+    std::ostringstream output{};
+    {
+        result_writer writer{output, false};
+        reads_file_t reads = open_reads(input);
+        number_of_records = search_reads(index_searcher, reads, writer, result_format::text, false, 1u);
+        writer.flush();
+    }
+
+    return std::move(output).str();
+}
+
+// The main thread accepts connections and queues them. Each worker answers the requests of one connection at a time.
+// All workers share one searcher.
+class server
+{
+public:
+    server(configuration const & config, searcher const & index_searcher) :
+        index_searcher{index_searcher},
+        max_request_size{config.max_request_size << 20},
+        idle_timeout{config.idle_timeout},
+        listener{unix_socket::listen(config.socket_path)}
+    {
+        std::tie(wake_receiver, wake_sender) = unix_socket::pair();
+    }
+
+    void run(size_t const threads)
+    {
+        std::vector<std::thread> workers;
+        workers.reserve(threads);
+        for (size_t i = 0; i < threads; ++i)
+            workers.emplace_back(&server::work, this);
+
+        // Waits for connections and for `stop()`, which writes to `wake_sender`.
+        std::array<pollfd, 2> events{{{.fd = listener.get(), .events = POLLIN, .revents = 0},
+                                      {.fd = wake_receiver.get(), .events = POLLIN, .revents = 0}}};
+        while (true)
+        {
+            if (::poll(events.data(), events.size(), -1) == -1)
+            {
+                if (errno == EINTR)
+                    continue;
+                throw std::runtime_error{std::string{"Could not wait for connections: "} + std::strerror(errno)};
+            }
+
+            if (events[1].revents != 0)
+                break;
+
+            unix_socket connection = listener.accept();
+            if (!connection.valid())
+                continue;
+
+            std::lock_guard const lock{mutex};
+            if (stopping)
+                break;
+            pending.push(std::move(connection));
+            ready.notify_one();
+        }
+
+        stop();
+        for (std::thread & worker : workers)
+            worker.join();
+    }
+
+    size_t requests() const noexcept
+    {
+        return request_count.load();
+    }
+
+private:
+    void work()
+    {
+        while (true)
+        {
+            unix_socket connection{};
+            {
+                std::unique_lock lock{mutex};
+                ready.wait(lock,
+                           [this]()
+                           {
+                               return stopping || !pending.empty();
+                           });
+                if (stopping)
+                    return;
+                connection = std::move(pending.front());
+                pending.pop();
+                active.insert(connection.get());
+            }
+
+            try
+            {
+                // Idle clients must not hold a worker forever.
+                connection.set_receive_timeout(idle_timeout);
+                handle(connection.get());
+            }
+            catch (std::exception const & ext)
+            {
+                log("[WARNING] " + std::string{ext.what()} + '\n', std::cerr);
+            }
+
+            std::lock_guard const lock{mutex};
+            active.erase(connection.get());
+        }
+    }
+
+    void handle(int const fd)
+    {
+        message request{};
+        while (true)
+        {
+            try
+            {
+                if (!read_message(fd, request, max_request_size))
+                    return;
+            }
+            catch (message_too_large const & ext)
+            {
+                // The rest of the stream cannot be interpreted anymore.
+                write_message(fd, message_type::error, ext.what());
+                throw;
+            }
+
+            switch (request.type)
+            {
+            case message_type::search:
+            {
+                size_t const id = ++request_count;
+                lap_clock clock{};
+                size_t number_of_records{};
+                std::string result;
+
+                try
+                {
+                    result = search_request(index_searcher, request.payload, number_of_records);
+                }
+                catch (std::exception const & ext)
+                {
+                    write_message(fd, message_type::error, ext.what());
+                    log("Request " + std::to_string(id) + " failed: " + ext.what() + '\n', std::cout);
+                    continue;
+                }
+
+                write_message(fd, message_type::result, result);
+
+                std::ostringstream line{};
+                line << "Request " << id << ": " << number_of_records << " reads in " << clock.lap() * 1000.0
+                     << " ms\n";
+                log(line.str(), std::cout);
+                break;
+            }
+            case message_type::shutdown:
+                stop();
+                write_message(fd, message_type::result, {});
+                return;
+            default:
+                write_message(fd, message_type::error, "Unknown request.");
+                return;
+            }
+        }
+    }
+
+    // Stops accepting connections and ends the connections that are being served once their current request is
+    // answered.
+    void stop()
+    {
+        std::lock_guard const lock{mutex};
+        if (stopping)
+            return;
+
+        stopping = true;
+        char const wake{};
+        [[maybe_unused]] ssize_t const written = ::write(wake_sender.get(), &wake, 1u);
+        for (int const fd : active)
+            ::shutdown(fd, SHUT_RD);
+        ready.notify_all();
+    }
+
+    void log(std::string const & line, std::ostream & stream)
+    {
+        std::lock_guard const lock{log_mutex};
+        stream << line << std::flush;
+    }
+
+    searcher const & index_searcher;
+    uint64_t max_request_size{};
+    uint32_t idle_timeout{};
+    unix_socket listener{};
+    unix_socket wake_receiver{};
+    unix_socket wake_sender{};
+
+    std::mutex mutex{};
+    std::condition_variable ready{};
+    std::queue<unix_socket> pending{};
+    std::unordered_set<int> active{};
+    bool stopping{false};
+
+    std::atomic<size_t> request_count{};
+    std::mutex log_mutex{};
+};
+
+} // namespace
+
+void serve(configuration const & config)
+{
+    searcher const index_searcher{config};
+
+    server instance{config, index_searcher};
+    std::cout << "Serving " << config.index_file << " on " << config.socket_path << " with " << config.threads
+              << " thread(s).\n"
+              << std::flush;
+
+    instance.run(config.threads);
+    std::filesystem::remove(config.socket_path);
+
+    std::cout << "Server stopped after " << instance.requests() << " request(s).\n";
+}
+
+void client(configuration const & config)
+{
+    unix_socket const connection = unix_socket::connect(config.socket_path);
+    uint64_t const no_limit = std::numeric_limits<uint64_t>::max();
+    message response{};
+
+    if (config.shutdown_server)
+    {
+        write_message(connection.get(), message_type::shutdown, {});
+        if (!read_message(connection.get(), response, no_limit))
+            throw std::runtime_error{"The server closed the connection."};
+        return;
+    }
+
+    mapped_file const reads{config.reads};
+    bool answered{false};
+    try
+    {
+        write_message(connection.get(), message_type::search, {reads.data().data(), reads.data().size()});
+    }
+    catch (std::runtime_error const &)
+    {
+        // The server stops reading a request that is too large and explains why.
+        answered = read_message(connection.get(), response, no_limit);
+        if (!answered)
+            throw;
+    }
+
+    if (!answered && !read_message(connection.get(), response, no_limit))
+        throw std::runtime_error{"The server closed the connection."};
+    if (response.type == message_type::error)
+        throw std::runtime_error{"The server could not answer the request: " + response.payload};
+
+    result_writer writer{config.search_output, config.print_results};
+    writer.write(response.payload);
+    writer.flush();
+}
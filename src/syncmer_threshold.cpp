@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include "syncmer_threshold.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+// Smallest a such that P(X <= a) >= tau for X ~ Binomial(n, p).
+static size_t binomial_quantile(size_t const n, double const p, double const tau)
+{
+    if (p >= 1.0)
+        return n;
+
+    double probability{1.0}; // P(X = 0)
+    for (size_t i = 0; i < n; ++i)
+        probability *= 1.0 - p;
+
+    double cumulative{probability};
+    size_t a{};
+    while (cumulative < tau && a < n)
+    {
+        probability *= static_cast<double>(n - a) / static_cast<double>(a + 1u) * p / (1.0 - p);
+        ++a;
+        cumulative += probability;
+    }
+
+    return a;
+}
+
+syncmer_threshold::syncmer_threshold(uint8_t const kmer_size, uint8_t const s)
+{
+    if (s == 0u || s > kmer_size)
+        throw std::invalid_argument{"Syncmer s-mer size must be in [1, k-mer size]."};
+
+    double const syncmer_probability = 1.0 / (kmer_size - s + 1u);
+
+    affected_syncmers.reserve(max_errors + 1u);
+    for (size_t errors = 0; errors <= max_errors; ++errors)
+        affected_syncmers.push_back(binomial_quantile(errors * kmer_size, syncmer_probability, tau));
+}
+
+size_t syncmer_threshold::get(size_t const syncmer_count, uint8_t const errors) const
+{
+    if (errors == 0u)
+        return syncmer_count;
+
+    if (errors >= affected_syncmers.size())
+        throw std::invalid_argument{"The syncmer threshold model supports at most " + std::to_string(max_errors)
+                                    + " errors."};
+
+    size_t const affected = affected_syncmers[errors];
+    return syncmer_count > affected ? syncmer_count - affected : 1u;
+}
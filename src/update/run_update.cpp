@@ -0,0 +1,55 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include "update/run_update.hpp"
+
+#include "configuration.hpp"
+#include "update/update.hpp"
+
+void run_update(sharg::parser & parser)
+{
+    configuration config{};
+
+    parser.add_option(config.index_file,
+                      sharg::config{.short_id = 'i',
+                                    .long_id = "index",
+                                    .description = "HIBF index file to update.",
+                                    .required = true,
+                                    .validator = sharg::input_file_validator{}});
+
+    parser.add_option(
+        config.index_output,
+        sharg::config{.short_id = 'o',
+                      .long_id = "output",
+                      .description = "Where to store the updated index.",
+                      .default_message = "overwrite --index",
+                      .validator = sharg::output_file_validator{sharg::output_file_open_options::open_or_create}});
+
+    parser.add_option(config.file_list_path,
+                      sharg::config{.long_id = "add",
+                                    .description = "A file containing one sequence file or .hashes file per line. "
+                                                   "Each file is added as a new user bin.",
+                                    .validator = sharg::input_file_validator{}});
+
+    parser.add_option(config.user_bins_to_remove,
+                      sharg::config{.long_id = "remove",
+                                    .description = "ID of a user bin to remove. Can be given multiple times."});
+
+    parser.add_option(config.threads,
+                      sharg::config{.long_id = "threads",
+                                    .description = "The number of threads to use.",
+                                    .validator = sharg::arithmetic_range_validator{1, 1024}});
+
+    parser.add_flag(config.compress_index,
+                    sharg::config{.long_id = "compress",
+                                  .description = "Store the index in independently compressed blocks. Compressed "
+                                                 "indexes stay compressed."});
+
+    parser.parse();
+
+    if (!parser.is_option_set("output"))
+        config.index_output = config.index_file;
+
+    update(config);
+}
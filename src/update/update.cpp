@@ -0,0 +1,191 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include "update/update.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <ranges>
+#include <iostream>
+
+#include "build/build.hpp"
+#include "hash/hash.hpp"
+#include "hash_file.hpp"
+#include "index_data.hpp"
+
+// New user bins are split into as many technical bins as needed to stay below this false positive rate.
+static constexpr double maximum_fpr{0.05};
+// A full rebuild is recommended once more than this fraction of the user bins is removed...
+static constexpr double rebuild_removed_fraction{0.25};
+// ...or once the top-level IBF has more than this many times the technical bins a new layout would use.
+static constexpr size_t rebuild_top_level_growth{2u};
+
+// The number of hashes a technical bin of `ibf` holds with a false positive rate of at most `maximum_fpr`.
+static size_t technical_bin_capacity(seqan::hibf::interleaved_bloom_filter const & ibf)
+{
+    double const hash_functions = ibf.hash_function_count();
+    double const bits = ibf.bin_size();
+    double const capacity = -bits * std::log(1.0 - std::pow(maximum_fpr, 1.0 / hash_functions)) / hash_functions;
+    return std::max<size_t>(1u, static_cast<size_t>(capacity));
+}
+
+// The element type of `ibf_bin_to_user_bin_id`. Depending on the HIBF version, merged bins are -1 in int64_t or
+// special values at the top of uint64_t. Either way, they are not below `number_of_user_bins` when read as uint64_t.
+using technical_bin_owner_t = std::ranges::range_value_t<
+    std::ranges::range_value_t<decltype(seqan::hibf::hierarchical_interleaved_bloom_filter::ibf_bin_to_user_bin_id)>>;
+
+// Whether a technical bin belongs to a user bin, as opposed to being merged.
+static bool is_user_bin(myindex const & index, technical_bin_owner_t const owner)
+{
+    return static_cast<uint64_t>(owner) < index.hibf.number_of_user_bins;
+}
+
+// Clears the technical bins of the user bins on all levels and marks them as removed. Merged bins on higher levels
+// still contain their hashes, which only costs an occasional unnecessary descent into a lower level. The cleared bins
+// keep their owner, so that IDs stay stable and `add_user_bin` can find them; `removed_user_bins` records which owners
+// are gone.
+static void remove_user_bins(myindex & index, std::vector<uint64_t> const & user_bin_ids)
+{
+    auto & hibf = index.hibf;
+
+    for (uint64_t const user_bin_id : user_bin_ids)
+    {
+        if (user_bin_id >= hibf.number_of_user_bins)
+            throw std::invalid_argument{"User bin " + std::to_string(user_bin_id) + " does not exist."};
+        if (index.is_removed(user_bin_id))
+            throw std::invalid_argument{"User bin " + std::to_string(user_bin_id) + " is already removed."};
+
+        for (size_t ibf_id = 0; ibf_id < hibf.ibf_vector.size(); ++ibf_id)
+        {
+            auto const & technical_bin_owners = hibf.ibf_bin_to_user_bin_id[ibf_id];
+            for (size_t bin = 0; bin < technical_bin_owners.size(); ++bin)
+                if (technical_bin_owners[bin] == static_cast<technical_bin_owner_t>(user_bin_id))
+                    hibf.ibf_vector[ibf_id].clear(seqan::hibf::bin_index{bin});
+        }
+
+        index.removed_user_bins.insert(std::ranges::upper_bound(index.removed_user_bins, user_bin_id), user_bin_id);
+    }
+}
+
+// Returns the first of `count` consecutive technical bins of the top-level IBF that belong to removed user bins.
+// Returns the number of technical bins if there are none.
+static size_t find_free_technical_bins(myindex const & index, size_t const count)
+{
+    auto const & technical_bin_owners = index.hibf.ibf_bin_to_user_bin_id[0];
+    size_t free_bins{};
+
+    for (size_t bin = 0; bin < technical_bin_owners.size(); ++bin)
+    {
+        technical_bin_owner_t const owner = technical_bin_owners[bin];
+        free_bins = (is_user_bin(index, owner) && index.is_removed(static_cast<uint64_t>(owner))) ? free_bins + 1u : 0u;
+
+        if (free_bins == count)
+            return bin + 1u - count;
+    }
+
+    return technical_bin_owners.size();
+}
+
+// Adds a user bin to the top-level IBF. It reuses technical bins of removed user bins if possible, and appends new
+// technical bins otherwise. Like split bins of the HIBF, a large user bin spans consecutive technical bins.
+static uint64_t add_user_bin(myindex & index, std::span<uint64_t const> const hashes)
+{
+    auto & hibf = index.hibf;
+    auto & top_level = hibf.ibf_vector[0];
+    auto & technical_bin_owners = hibf.ibf_bin_to_user_bin_id[0];
+
+    size_t const capacity = technical_bin_capacity(top_level);
+    size_t const count = std::max<size_t>(1u, (hashes.size() + capacity - 1u) / capacity);
+
+    size_t first_bin = find_free_technical_bins(index, count);
+    if (first_bin == technical_bin_owners.size())
+    {
+        size_t const new_bin_count = first_bin + count;
+        if (top_level.bin_count() < new_bin_count)
+            top_level.increase_bin_number_to(seqan::hibf::bin_count{new_bin_count});
+
+        technical_bin_owners.resize(new_bin_count);
+        hibf.next_ibf_id[0].resize(new_bin_count, 0); // Not merged: the bins point to their own IBF.
+    }
+
+    uint64_t const user_bin_id = hibf.number_of_user_bins++;
+    std::fill_n(technical_bin_owners.begin() + first_bin, count, static_cast<technical_bin_owner_t>(user_bin_id));
+
+    size_t const hashes_per_bin = std::max<size_t>(1u, (hashes.size() + count - 1u) / count);
+    for (size_t i = 0; i < hashes.size(); ++i)
+        top_level.emplace(hashes[i], seqan::hibf::bin_index{first_bin + i / hashes_per_bin});
+
+    return user_bin_id;
+}
+
+static void print_rebuild_recommendation(myindex const & index)
+{
+    size_t const user_bins = index.hibf.number_of_user_bins;
+    size_t const removed = index.removed_user_bins.size();
+    size_t const top_level_bins = index.hibf.ibf_bin_to_user_bin_id[0].size();
+
+    // The HIBF's default maximum number of technical bins: sqrt(user bins), rounded up to a multiple of 64.
+    size_t const remaining = user_bins - removed;
+    size_t const new_layout_bins = (static_cast<size_t>(std::ceil(std::sqrt(remaining))) + 63u) / 64u * 64u;
+
+    if (removed > rebuild_removed_fraction * user_bins)
+        std::cout << "A full rebuild is recommended: " << removed << " of " << user_bins
+                  << " user bins are removed.\n";
+    else if (top_level_bins > rebuild_top_level_growth * new_layout_bins)
+        std::cout << "A full rebuild is recommended: the top-level IBF has " << top_level_bins
+                  << " technical bins, a new layout would use at most " << new_layout_bins << ".\n";
+}
+
+void update(configuration const & config)
+{
+    bool const compress = config.compress_index
+                       || index_header::read(config.index_file).compression != payload_compression::none;
+
+    myindex index{};
+    index.load(config.index_file, config.threads);
+
+    // Indexes without a hash type predate syncmers and use minimisers.
+    hash_parameters const parameters{.hash = (index.hash == hash_type::syncmer) ? hash_type::syncmer
+                                                                                : hash_type::minimiser,
+                                     .kmer_size = index.kmer_size,
+                                     .window_size = index.window_size,
+                                     .s = index.s,
+                                     .t = index.t};
+    std::string const key = hash_parameters_key(parameters);
+
+    std::vector<std::string> const user_bin_paths =
+        config.file_list_path.empty() ? std::vector<std::string>{} : parse_user_bins(config.file_list_path);
+
+    remove_user_bins(index, config.user_bins_to_remove);
+
+    uint64_t const first_new_user_bin = index.hibf.number_of_user_bins;
+    std::vector<uint64_t> hashes;
+    for (std::string const & path : user_bin_paths)
+    {
+        if (is_hash_file(path))
+        {
+            hash_file const file{path};
+            if (std::string const file_key = hash_parameters_key(file.parameters()); file_key != key)
+                throw std::runtime_error{path + " contains " + file_key + " hashes, but the index uses " + key + '.'};
+
+            add_user_bin(index, file.hashes());
+        }
+        else
+        {
+            hash_user_bin(path, parameters, hashes);
+            add_user_bin(index, hashes);
+        }
+    }
+
+    index.store(config.index_output, compress, config.threads);
+
+    std::cout << "Removed user bins: " << config.user_bins_to_remove.size() << "\n";
+    std::cout << "Added user bins: " << user_bin_paths.size() << "\n";
+    if (!user_bin_paths.empty())
+        std::cout << "IDs of the added user bins: " << first_new_user_bin << " to "
+                  << index.hibf.number_of_user_bins - 1u << "\n";
+    std::cout << "HIBF index updated and saved to " << config.index_output << "\n";
+
+    print_rebuild_recommendation(index);
+}
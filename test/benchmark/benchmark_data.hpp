@@ -0,0 +1,75 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+
+#include <hibf/config.hpp>
+#include <hibf/hierarchical_interleaved_bloom_filter.hpp>
+
+// The same random text of 1 Mbp for every benchmark, so that results are comparable between runs.
+inline std::vector<seqan3::dna4> const & random_text()
+{
+    static std::vector<seqan3::dna4> const text = []()
+    {
+        std::mt19937_64 engine{42u};
+        std::vector<seqan3::dna4> result(1'000'000u);
+        for (auto & symbol : result)
+            symbol.assign_rank(engine() % 4u);
+        return result;
+    }();
+    return text;
+}
+
+// The hashes of a user bin of `random_hibf`.
+inline std::vector<uint64_t> random_hashes(size_t const user_bin_id, size_t const count)
+{
+    std::mt19937_64 engine{user_bin_id};
+    std::vector<uint64_t> result(count);
+    for (uint64_t & hash : result)
+        hash = engine();
+    return result;
+}
+
+// An HIBF with the parameters `build` uses by default.
+inline seqan::hibf::hierarchical_interleaved_bloom_filter random_hibf(size_t const number_of_user_bins,
+                                                                      size_t const hashes_per_user_bin)
+{
+    seqan::hibf::config config{.input_fn =
+                                   [hashes_per_user_bin](size_t const user_bin_id, seqan::hibf::insert_iterator it)
+                               {
+                                   std::ranges::copy(random_hashes(user_bin_id, hashes_per_user_bin), it);
+                               },
+                               .number_of_user_bins = number_of_user_bins,
+                               .number_of_hash_functions = 2u,
+                               .maximum_fpr = 0.05};
+    return seqan::hibf::hierarchical_interleaved_bloom_filter{config};
+}
+
+// Reports the throughput as the `bases/s` counter in the JSON output.
+inline void set_bases_per_second(benchmark::State & state, size_t const bases_per_iteration)
+{
+    state.counters["bases/s"] =
+        benchmark::Counter(static_cast<double>(bases_per_iteration), benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// k and w.
+inline void minimiser_arguments(benchmark::internal::Benchmark * benchmark)
+{
+    benchmark->ArgNames({"k", "w"});
+    benchmark->Args({20, 20})->Args({20, 24})->Args({19, 40})->Args({31, 31});
+}
+
+// k, s and t.
+inline void syncmer_arguments(benchmark::internal::Benchmark * benchmark)
+{
+    benchmark->ArgNames({"k", "s", "t"});
+    benchmark->Args({15, 11, 2})->Args({20, 11, 4})->Args({31, 15, 8});
+}
@@ -0,0 +1,82 @@
+# SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+# SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+# SPDX-License-Identifier: CC0-1.0
+
+"""Generates random genomes and reads sampled from them with substitution errors.
+
+The output only depends on the arguments: the same seed always yields the same files.
+Each user bin is one genome. Read ids name the bin they were sampled from, e.g. `read7_bin3`.
+"""
+
+import argparse
+import random
+from pathlib import Path
+
+ALPHABET = "ACGT"
+LINE_LENGTH = 80
+
+
+def random_genome(rng, size):
+    return "".join(rng.choices(ALPHABET, k=size))
+
+
+def mutate(rng, sequence, error_rate):
+    bases = list(sequence)
+    for i in range(len(bases)):
+        if rng.random() < error_rate:
+            bases[i] = rng.choice(ALPHABET.replace(bases[i], ""))
+    return "".join(bases)
+
+
+def write_fasta(path, name, sequence):
+    with open(path, "w", encoding="utf-8") as file:
+        file.write(f">{name}\n")
+        for start in range(0, len(sequence), LINE_LENGTH):
+            file.write(sequence[start : start + LINE_LENGTH] + "\n")
+
+
+def generate(directory, bins, genome_size, read_length, reads, error_rate, seed):
+    """Writes bin_<i>.fa, list.txt and reads.fq to `directory`. Returns the paths of the file list and the reads."""
+    if read_length > genome_size:
+        raise ValueError("The read length must not exceed the genome size.")
+
+    directory = Path(directory)
+    directory.mkdir(parents=True, exist_ok=True)
+    rng = random.Random(seed)
+
+    genomes = []
+    for user_bin in range(bins):
+        genome = random_genome(rng, genome_size)
+        genomes.append(genome)
+        write_fasta(directory / f"bin_{user_bin}.fa", f"bin_{user_bin}", genome)
+
+    file_list = directory / "list.txt"
+    file_list.write_text("".join(f"{(directory / f'bin_{i}.fa').resolve()}\n" for i in range(bins)), encoding="utf-8")
+
+    reads_file = directory / "reads.fq"
+    with open(reads_file, "w", encoding="utf-8") as file:
+        for read in range(reads):
+            user_bin = rng.randrange(bins)
+            start = rng.randrange(genome_size - read_length + 1)
+            sequence = mutate(rng, genomes[user_bin][start : start + read_length], error_rate)
+            file.write(f"@read{read}_bin{user_bin}\n{sequence}\n+\n{'I' * read_length}\n")
+
+    return file_list, reads_file
+
+
+def add_arguments(parser):
+    parser.add_argument("--bins", type=int, default=64, help="Number of user bins (genomes).")
+    parser.add_argument("--genome_size", type=int, default=100_000, help="Length of each genome.")
+    parser.add_argument("--read_length", type=int, default=150, help="Length of each read.")
+    parser.add_argument("--reads", type=int, default=10_000, help="Number of reads.")
+    parser.add_argument("--error_rate", type=float, default=0.01, help="Substitution rate of the reads.")
+    parser.add_argument("--seed", type=int, default=42, help="Seed of the random number generator.")
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("directory", type=Path, help="Where to write the files.")
+    add_arguments(parser)
+    args = parser.parse_args()
+
+    generate(args.directory, args.bins, args.genome_size, args.read_length, args.reads, args.error_rate, args.seed)
@@ -0,0 +1,81 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <benchmark/benchmark.h>
+
+#include <seqan3/search/views/minimiser_hash.hpp>
+
+#include "benchmark_data.hpp"
+#include "contrib/syncmer.hpp"
+#include "hashing.hpp"
+
+// The seqan3 views and the kernels of hashing.hpp produce the same hashes; see hashing_test.cpp.
+
+void minimiser_view(benchmark::State & state)
+{
+    uint8_t const kmer_size = state.range(0);
+    uint32_t const window_size = state.range(1);
+    std::vector<seqan3::dna4> const & text = random_text();
+    auto const adaptor = seqan3::views::minimiser_hash(seqan3::ungapped{kmer_size}, seqan3::window_size{window_size});
+
+    for (auto _ : state)
+        for (uint64_t const hash : text | adaptor)
+            benchmark::DoNotOptimize(hash);
+
+    set_bases_per_second(state, text.size());
+}
+
+void minimiser_kernel(benchmark::State & state)
+{
+    hash_parameters const parameters{.hash = hash_type::minimiser,
+                                     .kmer_size = static_cast<uint8_t>(state.range(0)),
+                                     .window_size = static_cast<uint8_t>(state.range(1))};
+    std::vector<seqan3::dna4> const & text = random_text();
+    std::vector<uint64_t> hashes;
+
+    for (auto _ : state)
+    {
+        minimiser_hashes(text, parameters, hashes);
+        benchmark::DoNotOptimize(hashes.data());
+    }
+
+    set_bases_per_second(state, text.size());
+}
+
+void syncmer_view(benchmark::State & state)
+{
+    seqan3::detail::syncmer_params const params{.kmer_size = static_cast<size_t>(state.range(0)),
+                                                .smer_size = static_cast<size_t>(state.range(1)),
+                                                .offset = static_cast<size_t>(state.range(2))};
+    std::vector<seqan3::dna4> const & text = random_text();
+
+    for (auto _ : state)
+        for (uint64_t const hash : text | seqan3::views::syncmer(params))
+            benchmark::DoNotOptimize(hash);
+
+    set_bases_per_second(state, text.size());
+}
+
+void syncmer_kernel(benchmark::State & state)
+{
+    hash_parameters const parameters{.hash = hash_type::syncmer,
+                                     .kmer_size = static_cast<uint8_t>(state.range(0)),
+                                     .s = static_cast<uint8_t>(state.range(1)),
+                                     .t = static_cast<uint8_t>(state.range(2))};
+    std::vector<seqan3::dna4> const & text = random_text();
+    std::vector<uint64_t> hashes;
+
+    for (auto _ : state)
+    {
+        syncmer_hashes(text, parameters, hashes);
+        benchmark::DoNotOptimize(hashes.data());
+    }
+
+    set_bases_per_second(state, text.size());
+}
+
+BENCHMARK(minimiser_view)->Apply(minimiser_arguments);
+BENCHMARK(minimiser_kernel)->Apply(minimiser_arguments);
+BENCHMARK(syncmer_view)->Apply(syncmer_arguments);
+BENCHMARK(syncmer_kernel)->Apply(syncmer_arguments);
@@ -0,0 +1,65 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <benchmark/benchmark.h>
+
+#include "benchmark_data.hpp"
+#include "block_compression.hpp"
+#include "index_data.hpp"
+
+// Roughly 100 MiB of bit vectors.
+static constexpr size_t number_of_user_bins{1024u};
+static constexpr size_t hashes_per_user_bin{100'000u};
+
+myindex const & benchmark_index()
+{
+    static myindex const index{configuration{.hash = hash_type::minimiser},
+                               random_hibf(number_of_user_bins, hashes_per_user_bin)};
+    return index;
+}
+
+std::filesystem::path index_path(bool const compress)
+{
+    return std::filesystem::temp_directory_path() / (compress ? "benchmark_compressed.index" : "benchmark.index");
+}
+
+// The bandwidth is reported in bytes of the index file.
+void store(benchmark::State & state)
+{
+    bool const compress = state.range(0);
+    if (compress && !block_compression_available())
+        return state.SkipWithError("Built without zlib.");
+
+    myindex const & index = benchmark_index();
+    std::filesystem::path const path = index_path(compress);
+
+    for (auto _ : state)
+        index.store(path, compress);
+
+    state.SetBytesProcessed(state.iterations() * std::filesystem::file_size(path));
+}
+
+// Loads the file written by `store`. The first iteration may read from disk, later ones from the page cache.
+void load(benchmark::State & state)
+{
+    bool const compress = state.range(0);
+    if (compress && !block_compression_available())
+        return state.SkipWithError("Built without zlib.");
+
+    std::filesystem::path const path = index_path(compress);
+    benchmark_index().store(path, compress);
+
+    for (auto _ : state)
+    {
+        myindex index{};
+        index.load(path);
+        benchmark::DoNotOptimize(index.hibf.ibf_vector.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * std::filesystem::file_size(path));
+    std::filesystem::remove(path);
+}
+
+BENCHMARK(store)->ArgName("compress")->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(load)->ArgName("compress")->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,90 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <benchmark/benchmark.h>
+
+#include "benchmark_data.hpp"
+#include "search/batch_membership_agent.hpp"
+
+// The number of hashes of a query; roughly those of a 150 bp read.
+static constexpr size_t query_hashes{100u};
+static constexpr size_t hashes_per_user_bin{10'000u};
+// As many queries as a search thread handles per batch.
+static constexpr size_t batch_size{4096u};
+
+// Each query consists of hashes of one user bin.
+std::vector<std::vector<uint64_t>> random_queries(size_t const number_of_user_bins)
+{
+    std::vector<std::vector<uint64_t>> queries(batch_size);
+    for (size_t i = 0; i < batch_size; ++i)
+    {
+        queries[i] = random_hashes(i % number_of_user_bins, hashes_per_user_bin);
+        queries[i].resize(query_hashes);
+    }
+    return queries;
+}
+
+// Latency of a single query, for increasing numbers of user bins.
+void membership_for(benchmark::State & state)
+{
+    size_t const number_of_user_bins = state.range(0);
+    auto const hibf = random_hibf(number_of_user_bins, hashes_per_user_bin);
+    auto agent = hibf.membership_agent();
+
+    std::vector<uint64_t> query = random_hashes(number_of_user_bins / 2u, hashes_per_user_bin);
+    query.resize(query_hashes);
+
+    for (auto _ : state)
+    {
+        auto & result = agent.membership_for(query, query_hashes);
+        benchmark::DoNotOptimize(result.data());
+    }
+
+    state.counters["queries/s"] = benchmark::Counter(1.0, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// Throughput of a batch of queries, one read at a time. The baseline of `batch_membership_for`.
+void per_read_membership_for(benchmark::State & state)
+{
+    size_t const number_of_user_bins = state.range(0);
+    auto const hibf = random_hibf(number_of_user_bins, hashes_per_user_bin);
+    auto agent = hibf.membership_agent();
+    std::vector<std::vector<uint64_t>> const queries = random_queries(number_of_user_bins);
+
+    for (auto _ : state)
+    {
+        for (auto const & query : queries)
+        {
+            auto & result = agent.membership_for(query, query_hashes);
+            agent.sort_results();
+            benchmark::DoNotOptimize(result.data());
+        }
+    }
+
+    state.counters["queries/s"] = benchmark::Counter(batch_size, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// Throughput of the same batch with the batch_membership_agent that `search` uses.
+void batch_membership_for(benchmark::State & state)
+{
+    size_t const number_of_user_bins = state.range(0);
+    auto const hibf = random_hibf(number_of_user_bins, hashes_per_user_bin);
+    batch_membership_agent agent{hibf};
+    std::vector<std::vector<uint64_t>> const queries = random_queries(number_of_user_bins);
+
+    for (auto _ : state)
+    {
+        agent.clear();
+        for (auto const & query : queries)
+            agent.add(query, query_hashes);
+        agent.query();
+        benchmark::DoNotOptimize(agent.result(0).data());
+    }
+
+    state.counters["queries/s"] = benchmark::Counter(batch_size, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+BENCHMARK(membership_for)->ArgName("user_bins")->RangeMultiplier(4)->Range(64, 4096);
+BENCHMARK(per_read_membership_for)->ArgName("user_bins")->RangeMultiplier(4)->Range(64, 4096);
+BENCHMARK(batch_membership_for)->ArgName("user_bins")->RangeMultiplier(4)->Range(64, 4096);
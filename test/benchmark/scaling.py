@@ -0,0 +1,114 @@
+# SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+# SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+# SPDX-License-Identifier: CC0-1.0
+
+"""Builds and searches generated datasets of increasing size and writes the measurements as JSON.
+
+For each number of user bins and each hash, one record reports the build throughput (input bases/s), the index size,
+the search throughput (reads/s), the peak RSS of both runs, and the fraction of reads whose source bin was found.
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import tempfile
+import time
+from pathlib import Path
+
+from generate import add_arguments, generate
+
+BASE_DIR = Path(__file__).resolve().parents[2]
+
+HASHES = {
+    "kmer": ["minimiser", "--kmer", "20", "--window", "20"],
+    "minimiser": ["minimiser", "--kmer", "20", "--window", "24"],
+    "syncmer": ["syncmer", "--kmer", "15", "--syncmer_s", "11", "--syncmer_t", "2"],
+}
+
+
+def run(command):
+    """Runs `command` and returns the wall time in seconds and the peak RSS in bytes."""
+    # stderr goes to a file; a pipe that nobody drains blocks the process once it is full.
+    with tempfile.TemporaryFile() as stderr:
+        start = time.perf_counter()
+        process = subprocess.Popen([str(part) for part in command], stdout=subprocess.DEVNULL, stderr=stderr)
+        _, status, usage = os.wait4(process.pid, 0)
+        elapsed = time.perf_counter() - start
+
+        if os.waitstatus_to_exitcode(status) != 0:
+            stderr.seek(0)
+            raise RuntimeError(f"{' '.join(map(str, command))} failed:\n{stderr.read().decode(errors='replace')}")
+
+    return elapsed, usage.ru_maxrss * 1024  # ru_maxrss is in KiB on Linux.
+
+
+def recall(search_output):
+    """The fraction of reads that report the bin they were sampled from."""
+    found = total = 0
+    with open(search_output, encoding="utf-8") as file:
+        for line in file:
+            name, hits = line.rstrip("\n").split(": ")
+            source = name.rsplit("_bin", 1)[1]
+            found += source in hits.strip("[]").split(",")
+            total += 1
+    return found / total if total else 0.0
+
+
+def benchmark(args, bins):
+    directory = args.work_dir / f"bins_{bins}"
+    file_list, reads = generate(
+        directory, bins, args.genome_size, args.read_length, args.reads, args.error_rate, args.seed
+    )
+
+    records = []
+    for name, build_arguments in HASHES.items():
+        index = directory / f"{name}.index"
+        search_output = directory / f"{name}.out"
+        threads = ["--threads", str(args.threads)]
+
+        build_time, build_rss = run([args.binary, "build", *build_arguments, "-i", file_list, "-o", index, *threads])
+        search_time, search_rss = run(
+            [args.binary, "search", "-i", index, "-r", reads, "-o", search_output, "-e", str(args.errors), *threads]
+        )
+
+        records.append(
+            {
+                "hash": name,
+                "bins": bins,
+                "genome_size": args.genome_size,
+                "reads": args.reads,
+                "read_length": args.read_length,
+                "error_rate": args.error_rate,
+                "errors": args.errors,
+                "threads": args.threads,
+                "seed": args.seed,
+                "build_seconds": build_time,
+                "build_bases_per_second": bins * args.genome_size / build_time,
+                "build_peak_rss_bytes": build_rss,
+                "index_bytes": index.stat().st_size,
+                "search_seconds": search_time,
+                "search_reads_per_second": args.reads / search_time,
+                "search_peak_rss_bytes": search_rss,
+                "recall": recall(search_output),
+            }
+        )
+        print(f"{name}, {bins} bins: build {build_time:.2f}s, search {search_time:.2f}s", flush=True)
+
+    return records
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--binary", type=Path, default=BASE_DIR / "build" / "HIBF-hashing", help="HIBF-hashing.")
+    parser.add_argument("--work_dir", type=Path, default=Path("scaling"), help="Where to write datasets and indexes.")
+    parser.add_argument("--output", type=Path, default=Path("scaling.json"), help="Where to write the results.")
+    parser.add_argument("--scale", type=int, nargs="+", default=[16, 64, 256], help="Numbers of user bins to run.")
+    parser.add_argument("--errors", type=int, default=2, help="Number of errors allowed by search.")
+    parser.add_argument("--threads", type=int, default=1, help="Number of threads of build and search.")
+    add_arguments(parser)
+    args = parser.parse_args()
+
+    results = [record for bins in args.scale for record in benchmark(args, bins)]
+    args.output.write_text(json.dumps(results, indent=2) + "\n", encoding="utf-8")
+    print(f"Results were saved to: {args.output}")
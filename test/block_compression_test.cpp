@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <gtest/gtest.h>
+
+#include <iterator>
+#include <random>
+#include <sstream>
+
+#include "block_compression.hpp"
+
+std::string round_trip(std::string const & input, size_t const threads, size_t const block_size)
+{
+    std::ostringstream compressed;
+    {
+        block_compressing_buffer buffer{compressed, threads, block_size};
+        {
+            std::ostream stream{&buffer};
+            stream.write(input.data(), input.size());
+        }
+        buffer.finish();
+    }
+
+    std::string const payload = compressed.str();
+    block_decompressing_buffer buffer{payload, threads + 1u};
+    std::istream stream{&buffer};
+    return {std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+}
+
+TEST(block_compression_test, round_trip)
+{
+    if (!block_compression_available())
+        GTEST_SKIP() << "zlib is not available.";
+
+    std::mt19937_64 engine{42u};
+
+    for (size_t const size : {0u, 1u, 100u, 4096u, 100000u})
+    {
+        // Mostly zero, like sparse bit vectors.
+        std::string input(size, '\0');
+        for (char & c : input)
+            if (engine() % 7u == 0u)
+                c = static_cast<char>(engine());
+
+        for (size_t const threads : {1u, 3u})
+            for (size_t const block_size : {16u, 1000u, 4096u})
+                EXPECT_TRUE(round_trip(input, threads, block_size) == input)
+                    << size << ' ' << threads << ' ' << block_size;
+    }
+}
+
+TEST(block_compression_test, corrupted)
+{
+    if (!block_compression_available())
+        GTEST_SKIP() << "zlib is not available.";
+
+    std::string const payload{"This is not a compressed payload."};
+    EXPECT_THROW((block_decompressing_buffer{payload, 1u}), std::runtime_error);
+}
@@ -4,8 +4,16 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <ranges>
+#include <sstream>
+#include <vector>
+
 #include "../app_test.hpp"
 #include <build/build.hpp>
+#include <build/memory_plan.hpp>
+#include <build/tune.hpp>
+#include <search/search.hpp>
 
 // To prevent issues when running multiple API tests in parallel, give each API test unique names:
 struct api_build_test : public app_test
@@ -90,3 +98,227 @@ TEST_F(api_build_test, default_config_syncmer)
     EXPECT_TRUE(string_from_file("new_syncmer.index") == string_from_file(data("syncmer.index")))
         << "Index files differ";
 }
+
+TEST_F(api_build_test, multiple_threads)
+{
+    for (hash_type const hash : {hash_type::minimiser, hash_type::syncmer})
+    {
+        configuration config{};
+        config.file_list_path = data("list.txt");
+        config.index_output = "threaded.index";
+        config.hash = hash;
+        config.kmer_size = (hash == hash_type::minimiser) ? 20 : 15;
+        config.window_size = 24;
+        config.threads = 4u;
+
+        testing::internal::CaptureStdout();
+        testing::internal::CaptureStderr();
+
+        EXPECT_NO_THROW(build(config));
+
+        std::string const build_cout = testing::internal::GetCapturedStdout();
+        std::string const build_cerr = testing::internal::GetCapturedStderr();
+
+        EXPECT_EQ("HIBF index built and saved to \"threaded.index\"\n"
+                  "Successfully processed 4 files.\n",
+                  build_cout);
+        EXPECT_EQ("", build_cerr);
+
+        // The bit layout may differ from a single-threaded build, but the query results must not.
+        config.reads = data("query.fq");
+        config.index_file = "threaded.index";
+        config.print_results = true;
+
+        testing::internal::CaptureStdout();
+        testing::internal::CaptureStderr();
+
+        EXPECT_NO_THROW(search(config));
+
+        std::string const search_cout = testing::internal::GetCapturedStdout();
+        std::string const search_cerr = testing::internal::GetCapturedStderr();
+
+        EXPECT_EQ("The following hits were found:\n"
+                  "query1: [0]\n"
+                  "query2: [1]\n"
+                  "query3: [2]\n",
+                  search_cout);
+        EXPECT_EQ("", search_cerr);
+    }
+}
+
+TEST_F(api_build_test, cache_hashes)
+{
+    std::filesystem::create_directory("tmp");
+
+    // The first build keeps all hashes in memory, the second one writes all of them to disk.
+    for (uint64_t const cache_memory : {1024u, 0u})
+    {
+        configuration config{};
+        config.file_list_path = data("list.txt");
+        config.index_output = "cached_minimiser.index";
+        config.kmer_size = 20;
+        config.window_size = 24;
+        config.hash = hash_type::minimiser;
+        config.cache_hashes = true;
+        config.cache_memory = cache_memory;
+        config.tmp_directory = "tmp";
+
+        testing::internal::CaptureStdout();
+        EXPECT_NO_THROW(build(config));
+        testing::internal::GetCapturedStdout();
+
+        EXPECT_TRUE(string_from_file("cached_minimiser.index") == string_from_file(data("minimiser.index")))
+            << "Index files differ for a cache memory of " << cache_memory << " MiB";
+        EXPECT_TRUE(std::filesystem::is_empty("tmp")) << "Temporary files were not removed";
+    }
+}
+
+TEST_F(api_build_test, tune)
+{
+    configuration config{};
+    config.file_list_path = data("list.txt");
+    config.index_output = "tuned.index";
+    config.kmer_size = 20;
+    config.window_size = 24;
+    config.hash = hash_type::minimiser;
+    config.tune = true;
+    config.tune_memory = 1024u; // Everything fits: the fastest candidate with the lowest FPR wins.
+
+    testing::internal::CaptureStdout();
+    testing::internal::CaptureStderr();
+
+    EXPECT_NO_THROW(build(config));
+
+    std::string const build_cout = testing::internal::GetCapturedStdout();
+    std::string const build_cerr = testing::internal::GetCapturedStderr();
+
+    // A header and one row per candidate: 4 hash function counts times 3 FPRs. The chosen row has a marker column.
+    std::istringstream lines{build_cout};
+    std::string line;
+    ASSERT_TRUE(std::getline(lines, line));
+    EXPECT_EQ(line, "Tuning on 4 of 4 user bins:");
+    ASSERT_TRUE(std::getline(lines, line));
+    EXPECT_EQ(line, "hash functions\tFPR\testimated size (MiB)\tquery cost (words/hash)");
+
+    std::vector<std::string> chosen_rows;
+    for (size_t row = 0; row < 12u; ++row)
+    {
+        ASSERT_TRUE(std::getline(lines, line));
+        std::vector<std::string> columns;
+        for (auto && column : line | std::views::split('\t'))
+            columns.emplace_back(column.begin(), column.end());
+
+        ASSERT_GE(columns.size(), 4u) << line;
+        EXPECT_EQ(columns[0], std::to_string(row / 3u + 1u)) << line;
+        if (columns.size() == 5u && columns[4] == "<- chosen")
+            chosen_rows.push_back(columns[0] + ' ' + columns[1]);
+        else
+            EXPECT_EQ(columns.size(), 4u) << line;
+    }
+    EXPECT_EQ(chosen_rows, std::vector<std::string>{"1 0.01"});
+    ASSERT_TRUE(std::getline(lines, line));
+    EXPECT_FALSE(line.starts_with("1\t") || line.starts_with("2\t")) << line;
+    EXPECT_EQ("", build_cerr);
+
+    config.reads = data("query.fq");
+    config.index_file = "tuned.index";
+    config.search_output = "tuned.out";
+    EXPECT_NO_THROW(search(config));
+    EXPECT_EQ("query1: [0]\n"
+              "query2: [1]\n"
+              "query3: [2]\n",
+              string_from_file("tuned.out"));
+}
+
+TEST_F(api_build_test, query_cost)
+{
+    EXPECT_DOUBLE_EQ(estimate_query_cost(2u, 0.05, 4u, 64u), 2.0); // Only the root.
+    // Two levels: the root, the IBF of the true hit, and one IBF per false positive merged bin of the root.
+    EXPECT_DOUBLE_EQ(estimate_query_cost(2u, 0.05, 4096u, 64u), 2.0 * (1.0 + 1.0 + 64 * 0.05));
+    EXPECT_DOUBLE_EQ(estimate_query_cost(3u, 0.05, 10000u, 128u), 3.0 * (1.0 + 1.0 + 128 * 0.05) * 2.0);
+    EXPECT_LT(estimate_query_cost(2u, 0.01, 4096u, 64u), estimate_query_cost(2u, 0.05, 4096u, 64u));
+    // No level has more IBFs to query than it has.
+    EXPECT_DOUBLE_EQ(estimate_query_cost(1u, 1.0, 1000000u, 64u), 1.0 + 64.0 + 4096.0 + 262144.0);
+}
+
+TEST_F(api_build_test, stats)
+{
+    configuration config{};
+    config.file_list_path = data("list.txt");
+    config.index_output = "stats.index";
+    config.kmer_size = 20;
+    config.window_size = 24;
+    config.hash = hash_type::minimiser;
+    config.stats_output = "build_stats.json";
+
+    testing::internal::CaptureStdout();
+    EXPECT_NO_THROW(build(config));
+    testing::internal::GetCapturedStdout();
+
+    // Statistics do not change the index.
+    EXPECT_TRUE(string_from_file("stats.index") == string_from_file(data("minimiser.index")));
+
+    std::string const stats = string_from_file("build_stats.json");
+    EXPECT_TRUE(stats.starts_with("{\n  \"command\": \"build\",")) << stats;
+    for (std::string const key : {"\"hibf_construction\": {\"wall_seconds\": ",
+                                  "\"store\": {\"wall_seconds\": ",
+                                  "\"parse_pass_1\": {\"thread_seconds\": ",
+                                  "\"hash_pass_1\": {\"thread_seconds\": ",
+                                  "\"parse_pass_2\": {\"thread_seconds\": ",
+                                  "\"hash_pass_2\": {\"thread_seconds\": ",
+                                  "\"user_bins\": 4\n",
+                                  "\"sequences\": 4,",
+                                  "\"hashes_per_user_bin\": [",
+                                  "\"peak_rss_bytes\": "})
+        EXPECT_NE(stats.find(key), std::string::npos) << key;
+}
+
+TEST_F(api_build_test, max_memory)
+{
+    std::filesystem::create_directory("tmp");
+
+    configuration config{};
+    config.file_list_path = data("list.txt");
+    config.index_output = "budget.index";
+    config.kmer_size = 20;
+    config.window_size = 24;
+    config.hash = hash_type::minimiser;
+    config.max_memory = 4096u;
+    config.tmp_directory = "tmp";
+
+    testing::internal::CaptureStdout();
+    testing::internal::CaptureStderr();
+
+    EXPECT_NO_THROW(build(config));
+
+    std::string const std_cout = testing::internal::GetCapturedStdout();
+    std::string const std_cerr = testing::internal::GetCapturedStderr();
+
+    EXPECT_EQ("Memory budget of 4096 MiB: about 0 MiB for the index, 1 thread(s), and a hash cache of 1023 MiB.\n"
+              "HIBF index built and saved to \"budget.index\"\n"
+              "Successfully processed 4 files.\n",
+              std_cout);
+    EXPECT_EQ("", std_cerr);
+    EXPECT_TRUE(string_from_file("budget.index") == string_from_file(data("minimiser.index")));
+}
+
+TEST_F(api_build_test, memory_plan)
+{
+    configuration config{};
+    config.kmer_size = 20;
+    config.window_size = 20;
+    config.hash = hash_type::minimiser;
+    config.threads = 64u;
+    config.max_memory = 1u;
+
+    // Each file has 418 bytes; one hash per base takes 32 bytes of intermediate data.
+    std::vector<std::string> const user_bin_paths = parse_user_bins(data("list.txt"));
+    memory_plan const plan = plan_memory(config, user_bin_paths, 0u);
+    EXPECT_EQ(plan.largest_user_bin, 418u * 32u);
+    EXPECT_EQ(plan.threads, (1u << 19) / (418u * 32u));
+    EXPECT_EQ(plan.cache_memory, 0u);
+
+    // The index is taken from the budget first.
+    EXPECT_EQ(plan_memory(config, user_bin_paths, 1u << 19).threads, (1u << 18) / (418u * 32u));
+    EXPECT_THROW(plan_memory(config, user_bin_paths, 1u << 20), std::runtime_error);
+}
@@ -88,6 +88,35 @@ TEST_F(cli_build_test, with_arguments_syncmer)
     EXPECT_EQ(result.err, "");
 }
 
+TEST_F(cli_build_test, with_arguments_threads)
+{
+    app_test_result const result = execute_app("HIBF-hashing",
+                                               "build",
+                                               "syncmer",
+                                               "--input",
+                                               data("list.txt"),
+                                               "--output new_syncmer.index",
+                                               "--kmer 15",
+                                               "--threads 2");
+
+    std::string const expected{"HIBF index built and saved to \"new_syncmer.index\"\n"
+                               "Successfully processed 4 files.\n"};
+
+    EXPECT_SUCCESS(result);
+    EXPECT_EQ(result.out, expected);
+    EXPECT_EQ(result.err, "");
+}
+
+TEST_F(cli_build_test, invalid_threads)
+{
+    app_test_result const result =
+        execute_app("HIBF-hashing", "build", "minimiser", "--input", data("list.txt"), "--threads 0");
+
+    EXPECT_FAILURE(result);
+    EXPECT_EQ(result.out, "");
+    EXPECT_TRUE(result.err.starts_with("[Error] Validation failed for option --threads:")) << result.err;
+}
+
 TEST_F(cli_build_test, missing_path)
 {
     app_test_result const result =
@@ -117,3 +146,25 @@ TEST_F(cli_build_test, invalid_output_path)
     EXPECT_EQ(result.out, "");
     EXPECT_EQ(result.err, "[Error] Validation failed for option -o/--output: Cannot write \"does/not/exist\"!\n");
 }
+
+TEST_F(cli_build_test, invalid_fpr)
+{
+    app_test_result const zero =
+        execute_app("HIBF-hashing", "build", "minimiser", "--input", data("list.txt"), "--fpr 0");
+
+    EXPECT_FAILURE(zero);
+    EXPECT_EQ(zero.out, "");
+    EXPECT_TRUE(zero.err.starts_with("[Error] Validation failed for option --fpr: Value 0")) << zero.err;
+
+    app_test_result const relaxed = execute_app("HIBF-hashing",
+                                                "build",
+                                                "minimiser",
+                                                "--input",
+                                                data("list.txt"),
+                                                "--fpr 0.1",
+                                                "--relaxed_fpr 0.05");
+
+    EXPECT_FAILURE(relaxed);
+    EXPECT_EQ(relaxed.out, "");
+    EXPECT_EQ(relaxed.err, "[Error] --relaxed_fpr (0.050000) must be at least --fpr (0.100000).\n");
+}
@@ -0,0 +1,117 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+
+#include "contrib/syncmer.hpp"
+
+std::vector<uint64_t> to_vector(auto && view)
+{
+    std::vector<uint64_t> result;
+    for (auto it = view.begin(); it != view.end(); it++)
+        result.push_back(*it);
+    return result;
+}
+
+// Recomputes the syncmers from vectors holding every s-mer of the text. A minimum carried over from the previous
+// k-mer is only replaced by a strictly smaller s-mer. The forward minimum is rescanned when it leaves the k-mer, ties
+// going to the last occurrence. Like in the view, the reverse complement minimum is rescanned when it was the most
+// recent s-mer of the previous k-mer, ties going to the first occurrence.
+std::vector<uint64_t> naive_syncmers(std::vector<seqan3::dna4> const & text,
+                                     seqan3::detail::syncmer_params const & params)
+{
+    auto fwd_value = [&](size_t const start, size_t const size)
+    {
+        uint64_t value{};
+        for (size_t i = start; i < start + size; ++i)
+            value = (value << 2) | seqan3::to_rank(text[i]);
+        return value;
+    };
+    auto rc_value = [&](size_t const start, size_t const size)
+    {
+        uint64_t value{};
+        for (size_t i = start + size; i > start; --i)
+            value = (value << 2) | (seqan3::to_rank(text[i - 1u]) ^ 3u);
+        return value;
+    };
+
+    size_t const smers_per_kmer = params.kmer_size - params.smer_size + 1u;
+    std::vector<uint64_t> fwd_smers;
+    std::vector<uint64_t> rc_smers;
+    for (size_t start = 0u; start + params.smer_size <= text.size(); ++start)
+    {
+        fwd_smers.push_back(fwd_value(start, params.smer_size));
+        rc_smers.push_back(rc_value(start, params.smer_size));
+    }
+
+    std::vector<uint64_t> result;
+    size_t fwd_min{};
+    size_t rc_min{};
+    for (size_t start = 0u; start + params.kmer_size <= text.size(); ++start)
+    {
+        size_t const last = start + smers_per_kmer - 1u;
+
+        if (start == 0u || fwd_min < start)
+        {
+            fwd_min = start;
+            for (size_t i = start; i <= last; ++i)
+                if (fwd_smers[i] <= fwd_smers[fwd_min])
+                    fwd_min = i;
+        }
+        else if (fwd_smers[last] < fwd_smers[fwd_min])
+        {
+            fwd_min = last;
+        }
+
+        if (start == 0u || rc_min == last - 1u)
+        {
+            rc_min = start;
+            for (size_t i = start; i <= last; ++i)
+                if (rc_smers[i] < rc_smers[rc_min])
+                    rc_min = i;
+        }
+        else if (rc_smers[last] < rc_smers[rc_min])
+        {
+            rc_min = last;
+        }
+
+        uint64_t const fwd_kmer = fwd_value(start, params.kmer_size);
+        uint64_t const rc_kmer = rc_value(start, params.kmer_size);
+        if (fwd_kmer <= rc_kmer ? fwd_min - start == params.offset : last - rc_min == params.offset)
+            result.push_back(std::min(fwd_kmer, rc_kmer));
+    }
+    return result;
+}
+
+TEST(syncmer_test, same_as_naive_implementation)
+{
+    std::mt19937_64 engine{42u};
+
+    for (size_t iteration = 0; iteration < 5000u; ++iteration)
+    {
+        size_t const kmer_size = 1u + engine() % 31u;
+        size_t const smer_size = 1u + engine() % kmer_size;
+        size_t const offset = engine() % (kmer_size - smer_size + 1u);
+        seqan3::detail::syncmer_params const params{.kmer_size = kmer_size, .smer_size = smer_size, .offset = offset};
+
+        // Small alphabets produce many equal s-mers, which exercises the tie-breaking.
+        size_t const alphabet_size = 1u + engine() % 4u;
+        std::vector<seqan3::dna4> text(kmer_size + engine() % 300u);
+        for (auto & symbol : text)
+            symbol.assign_rank(engine() % alphabet_size);
+
+        auto view = text | seqan3::views::syncmer(params);
+        std::vector<uint64_t> const expected = naive_syncmers(text, params);
+
+        EXPECT_EQ(to_vector(view), expected) << "k = " << kmer_size << ", s = " << smer_size << ", t = " << offset;
+        EXPECT_EQ(to_vector(std::as_const(view)), expected);
+    }
+}
@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <gtest/gtest.h>
+
+#include "../app_test.hpp"
+#include <build/build.hpp>
+#include <hash/hash.hpp>
+
+// To prevent issues when running multiple API tests in parallel, give each API test unique names:
+struct api_hash_test : public app_test
+{};
+
+TEST_F(api_hash_test, build_from_hashes)
+{
+    configuration config{};
+    config.file_list_path = data("list.txt");
+    config.hash_output_directory = "hashes";
+    config.kmer_size = 20;
+    config.window_size = 24;
+    config.hash = hash_type::minimiser;
+    config.threads = 2u;
+
+    testing::internal::CaptureStdout();
+    testing::internal::CaptureStderr();
+
+    EXPECT_NO_THROW(hash_user_bins(config));
+
+    std::string const std_cout = testing::internal::GetCapturedStdout();
+    std::string const std_cerr = testing::internal::GetCapturedStderr();
+
+    std::filesystem::path const file_list = std::filesystem::absolute("hashes") / "minimiser_k20_w24.txt";
+    std::string const expected_cout{"Hashes of 4 files written to \"hashes\"\n"
+                                    "File list for build: \""
+                                    + file_list.string() + "\"\n"};
+
+    EXPECT_EQ(expected_cout, std_cout);
+    EXPECT_EQ("", std_cerr);
+    EXPECT_TRUE(std::filesystem::exists("hashes/bin1.minimiser_k20_w24.hashes"));
+
+    // Building from the hashes yields the same index as building from the FASTA files.
+    config.file_list_path = file_list;
+    config.index_output = "from_hashes.index";
+
+    testing::internal::CaptureStdout();
+    EXPECT_NO_THROW(build(config));
+    testing::internal::GetCapturedStdout();
+
+    EXPECT_TRUE(string_from_file("from_hashes.index") == string_from_file(data("minimiser.index")))
+        << "Index files differ";
+}
+
+TEST_F(api_hash_test, different_parameters)
+{
+    configuration config{};
+    config.file_list_path = data("list.txt");
+    config.hash_output_directory = "hashes";
+    config.kmer_size = 20;
+    config.window_size = 24;
+    config.hash = hash_type::minimiser;
+
+    testing::internal::CaptureStdout();
+    EXPECT_NO_THROW(hash_user_bins(config));
+    testing::internal::GetCapturedStdout();
+
+    config.file_list_path = "hashes/minimiser_k20_w24.txt";
+    config.window_size = 20;
+    EXPECT_THROW(build(config), std::runtime_error);
+}
@@ -0,0 +1,34 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <algorithm>
+
+#include "../app_test.hpp"
+
+// To prevent issues when running multiple CLI tests in parallel, give each CLI test unique names:
+struct cli_hash_test : public app_test
+{};
+
+TEST_F(cli_hash_test, with_arguments_syncmer)
+{
+    app_test_result const result = execute_app("HIBF-hashing",
+                                               "hash",
+                                               "syncmer",
+                                               "--input",
+                                               data("list.txt"),
+                                               "--output syncmer_hashes",
+                                               "--kmer 15",
+                                               "--syncmer_s 11",
+                                               "--syncmer_t 2");
+
+    std::filesystem::path const file_list = std::filesystem::absolute("syncmer_hashes") / "syncmer_k15_s11_t2.txt";
+    std::string const expected{"Hashes of 4 files written to \"syncmer_hashes\"\n"
+                               "File list for build: \""
+                               + file_list.string() + "\"\n"};
+
+    EXPECT_SUCCESS(result);
+    EXPECT_EQ(result.out, expected);
+    EXPECT_EQ(result.err, "");
+    EXPECT_EQ(std::ranges::count(string_from_file(file_list), '\n'), 4);
+}
@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include <seqan3/search/views/minimiser_hash.hpp>
+
+#include "contrib/syncmer.hpp"
+#include "hashing.hpp"
+
+std::vector<seqan3::dna4> random_text(std::mt19937_64 & engine, size_t const size)
+{
+    // Small alphabets produce many equal values, which exercises the tie-breaking.
+    size_t const alphabet_size = 1u + engine() % 4u;
+    std::vector<seqan3::dna4> text(size);
+    for (auto & symbol : text)
+        symbol.assign_rank(engine() % alphabet_size);
+    return text;
+}
+
+TEST(hashing_test, minimiser_same_as_view)
+{
+    std::mt19937_64 engine{42u};
+    std::vector<uint64_t> hashes;
+
+    for (size_t iteration = 0; iteration < 2000u; ++iteration)
+    {
+        uint8_t const kmer_size = 1u + engine() % 32u;
+        uint8_t const window_size = kmer_size + engine() % 40u;
+        std::vector<seqan3::dna4> const text = random_text(engine, kmer_size + engine() % 300u);
+
+        minimiser_hashes(text, {.kmer_size = kmer_size, .window_size = window_size}, hashes);
+
+        auto view = text | seqan3::views::minimiser_hash(seqan3::ungapped{kmer_size}, seqan3::window_size{window_size});
+        std::vector<uint64_t> const expected(view.begin(), view.end());
+
+        EXPECT_EQ(hashes, expected) << "k = " << +kmer_size << ", w = " << +window_size << ", |text| = " << text.size();
+    }
+}
+
+TEST(hashing_test, syncmer_same_as_view)
+{
+    std::mt19937_64 engine{42u};
+    std::vector<uint64_t> hashes;
+
+    for (size_t iteration = 0; iteration < 2000u; ++iteration)
+    {
+        uint8_t const kmer_size = 1u + engine() % 31u;
+        uint8_t const s = 1u + engine() % kmer_size;
+        uint8_t const t = engine() % (kmer_size - s + 1u);
+        std::vector<seqan3::dna4> const text = random_text(engine, kmer_size + engine() % 300u);
+
+        syncmer_hashes(text, {.kmer_size = kmer_size, .s = s, .t = t}, hashes);
+
+        std::vector<uint64_t> expected;
+        for (uint64_t const hash : text | seqan3::views::syncmer({.kmer_size = kmer_size, .smer_size = s, .offset = t}))
+            expected.push_back(hash);
+
+        EXPECT_EQ(hashes, expected) << "k = " << +kmer_size << ", s = " << +s << ", t = " << +t;
+    }
+}
+
+TEST(hashing_test, short_sequence)
+{
+    std::vector<seqan3::dna4> const text(10u);
+    std::vector<uint64_t> hashes{1u, 2u, 3u};
+
+    compute_hashes(text, {.hash = hash_type::syncmer, .kmer_size = 15u, .s = 11u, .t = 2u}, hashes);
+    EXPECT_TRUE(hashes.empty());
+
+    hashes = {1u, 2u, 3u};
+    compute_hashes(text, {.hash = hash_type::minimiser, .kmer_size = 20u, .window_size = 24u}, hashes);
+    EXPECT_TRUE(hashes.empty());
+
+    EXPECT_THROW(compute_hashes(text, {}, hashes), std::runtime_error);
+}
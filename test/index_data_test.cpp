@@ -0,0 +1,90 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <gtest/gtest.h>
+
+#include "app_test.hpp"
+#include "index_data.hpp"
+
+struct index_data_test : public app_test
+{};
+
+TEST_F(index_data_test, store_and_load)
+{
+    myindex index{};
+    index.load(data("syncmer.index"));
+    index.store("stored.index");
+
+    EXPECT_TRUE(string_from_file("stored.index") == string_from_file(data("syncmer.index")));
+}
+
+TEST_F(index_data_test, payload_is_aligned)
+{
+    std::string const content = string_from_file(data("minimiser.index"));
+
+    ASSERT_GE(content.size(), 2u * index_header::alignment);
+    EXPECT_EQ(content.substr(0u, 8u), "HIBFHASH");
+    EXPECT_EQ(content.find_first_not_of('\0', sizeof(index_header)), 2u * index_header::alignment);
+}
+
+TEST_F(index_data_test, not_an_index)
+{
+    myindex index{};
+    EXPECT_THROW(index.load(data("query.fq")), std::runtime_error);
+
+    std::ofstream{"empty.index"};
+    EXPECT_THROW(index.load("empty.index"), std::runtime_error);
+}
+
+TEST_F(index_data_test, wrong_version)
+{
+    std::string content = string_from_file(data("minimiser.index"));
+    content[8] = 0x7F;
+    std::ofstream{"wrong_version.index", std::ios::binary} << content;
+
+    myindex index{};
+    EXPECT_THROW(index.load("wrong_version.index"), std::runtime_error);
+}
+
+TEST_F(index_data_test, header)
+{
+    myindex index{};
+    index.load(data("minimiser.index"));
+
+    index_header const expected = index_header::read(data("minimiser.index"));
+    index_header const header = index.header();
+
+    EXPECT_EQ(header.kmer_size, 20u);
+    EXPECT_EQ(header.window_size, 24u);
+    EXPECT_EQ(header.number_of_user_bins, 4u);
+    EXPECT_EQ(header.number_of_levels, 1u);
+    EXPECT_EQ(header.bytes_per_level, expected.bytes_per_level);
+    EXPECT_EQ(header.checksum, 0u);
+    EXPECT_NE(expected.checksum, 0u);
+}
+
+TEST_F(index_data_test, compressed)
+{
+    if (!block_compression_available())
+        GTEST_SKIP() << "zlib is not available.";
+
+    myindex index{};
+    index.load(data("kmer.index"));
+    index.store("compressed.index", true, 4u);
+
+    index_header const header = index_header::read("compressed.index");
+    EXPECT_EQ(header.compression, payload_compression::zlib_blocks);
+    EXPECT_LT(std::filesystem::file_size("compressed.index"), std::filesystem::file_size(data("kmer.index")));
+
+    // The checksum covers the compressed payload.
+    std::string const content = string_from_file("compressed.index");
+    EXPECT_EQ(header.checksum,
+              index_header::compute_checksum(std::span<char const>{content}.subspan(header.payload_offset)));
+
+    myindex decompressed{};
+    decompressed.load("compressed.index", 2u);
+    decompressed.store("decompressed.index");
+
+    EXPECT_TRUE(string_from_file("decompressed.index") == string_from_file(data("kmer.index")));
+}
@@ -0,0 +1,59 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <gtest/gtest.h>
+
+#include "../app_test.hpp"
+#include <info/info.hpp>
+
+// To prevent issues when running multiple API tests in parallel, give each API test unique names:
+struct api_info_test : public app_test
+{};
+
+TEST_F(api_info_test, syncmer)
+{
+    configuration config{};
+    config.index_file = data("syncmer.index");
+    config.verify_checksum = true;
+
+    testing::internal::CaptureStdout();
+    testing::internal::CaptureStderr();
+
+    EXPECT_NO_THROW(info(config));
+
+    std::string const std_cout = testing::internal::GetCapturedStdout();
+    std::string const std_cerr = testing::internal::GetCapturedStderr();
+
+    std::string const expected_cout{"Format version: 2\n"
+                                    "Hash: syncmer\n"
+                                    "k-mer size: 15\n"
+                                    "Window size: 20\n"
+                                    "s: 11\n"
+                                    "t: 2\n"
+                                    "User bins: 4\n"
+                                    "Levels: 1\n"
+                                    "Compression: none\n"
+                                    "Bytes on level 0: 720\n"
+                                    "Checksum: 18686e78bb3226e5\n"
+                                    "Checksum verified.\n"};
+
+    EXPECT_EQ(expected_cout, std_cout);
+    EXPECT_EQ("", std_cerr);
+}
+
+TEST_F(api_info_test, corrupted)
+{
+    std::string content = string_from_file(data("kmer.index"));
+    content.back() ^= 1;
+    std::ofstream{"corrupted.index", std::ios::binary} << content;
+
+    configuration config{};
+    config.index_file = "corrupted.index";
+
+    testing::internal::CaptureStdout();
+    EXPECT_NO_THROW(info(config));
+    config.verify_checksum = true;
+    EXPECT_THROW(info(config), std::runtime_error);
+    testing::internal::GetCapturedStdout();
+}
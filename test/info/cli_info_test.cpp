@@ -0,0 +1,39 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include "../app_test.hpp"
+
+// To prevent issues when running multiple CLI tests in parallel, give each CLI test unique names:
+struct cli_info_test : public app_test
+{};
+
+TEST_F(cli_info_test, with_arguments)
+{
+    app_test_result const result = execute_app("HIBF-hashing", "info", "--index", data("minimiser.index"));
+
+    std::string const expected{"Format version: 2\n"
+                               "Hash: minimiser\n"
+                               "k-mer size: 20\n"
+                               "Window size: 24\n"
+                               "s: 11\n"
+                               "t: 2\n"
+                               "User bins: 4\n"
+                               "Levels: 1\n"
+                               "Compression: none\n"
+                               "Bytes on level 0: 2424\n"
+                               "Checksum: 2d1a496c87c94e8b\n"};
+
+    EXPECT_SUCCESS(result);
+    EXPECT_EQ(result.out, expected);
+    EXPECT_EQ(result.err, "");
+}
+
+TEST_F(cli_info_test, not_an_index)
+{
+    app_test_result const result = execute_app("HIBF-hashing", "info", "--index", data("query.fq"));
+
+    EXPECT_FAILURE(result);
+    EXPECT_EQ(result.out, "");
+    EXPECT_EQ(result.err, "[Error] " + data("query.fq").string() + " is not an index file.\n");
+}
@@ -4,7 +4,15 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <limits>
+#include <sstream>
+#include <thread>
+
+#include <sys/stat.h>
+
 #include "../app_test.hpp"
+#include <search/result_format.hpp>
 #include <search/search.hpp>
 
 // To prevent issues when running multiple API tests in parallel, give each API test unique names:
@@ -19,6 +27,7 @@ TEST_F(api_search_test, default_config_kmer)
     config.kmer_size = 20;
     config.window_size = 20;
     config.hash = hash_type::minimiser;
+    config.print_results = true;
 
     testing::internal::CaptureStdout();
     testing::internal::CaptureStderr();
@@ -45,6 +54,7 @@ TEST_F(api_search_test, default_config_minimiser)
     config.kmer_size = 20;
     config.window_size = 24;
     config.hash = hash_type::minimiser;
+    config.print_results = true;
 
     testing::internal::CaptureStdout();
     testing::internal::CaptureStderr();
@@ -72,6 +82,7 @@ TEST_F(api_search_test, default_config_syncmer)
     config.s = 11;
     config.t = 2;
     config.hash = hash_type::syncmer;
+    config.print_results = true;
 
     testing::internal::CaptureStdout();
     testing::internal::CaptureStderr();
@@ -89,3 +100,291 @@ TEST_F(api_search_test, default_config_syncmer)
     EXPECT_EQ(expected_cout, std_cout);
     EXPECT_EQ("", std_cerr);
 }
+
+TEST_F(api_search_test, multiple_threads)
+{
+    // Enough reads to span several batches.
+    {
+        std::string const query = string_from_file(data("query.fq"));
+        std::ofstream reads{"many_reads.fq"};
+        for (size_t i = 0; i < 3000u; ++i)
+            reads << query;
+    }
+
+    for (std::string const index : {"kmer.index", "minimiser.index", "syncmer.index"})
+    {
+        configuration config{};
+        config.reads = "many_reads.fq";
+        config.index_file = data(index);
+        config.error = 2u;
+
+        config.search_output = "serial.out";
+        EXPECT_NO_THROW(search(config));
+        config.threads = 2u;
+        config.search_output = "parallel.out";
+        EXPECT_NO_THROW(search(config));
+
+        EXPECT_TRUE(string_from_file("serial.out") == string_from_file("parallel.out"))
+            << "Results differ for " << index;
+    }
+}
+
+TEST_F(api_search_test, no_print_results)
+{
+    configuration config{};
+    config.reads = data("query.fq");
+    config.index_file = data("minimiser.index");
+    config.search_output = "result.out";
+
+    testing::internal::CaptureStdout();
+    testing::internal::CaptureStderr();
+
+    EXPECT_NO_THROW(search(config));
+
+    std::string const std_cout = testing::internal::GetCapturedStdout();
+    std::string const std_cerr = testing::internal::GetCapturedStderr();
+
+    EXPECT_EQ("", std_cout);
+    EXPECT_EQ("", std_cerr);
+    EXPECT_EQ("query1: [0]\n"
+              "query2: [1]\n"
+              "query3: [2]\n",
+              string_from_file("result.out"));
+}
+
+TEST_F(api_search_test, threshold_cache)
+{
+    configuration config{};
+    config.reads = data("query.fq");
+    config.index_file = data("minimiser.index");
+    config.error = 2u;
+    config.threshold_cache = "threshold_cache";
+
+    config.search_output = "uncached.out";
+    EXPECT_NO_THROW(search(config));
+
+    size_t cached_files{};
+    for ([[maybe_unused]] auto const & entry : std::filesystem::directory_iterator{config.threshold_cache})
+        ++cached_files;
+    EXPECT_EQ(cached_files, 2u); // Thresholds and correction.
+
+    config.search_output = "cached.out";
+    EXPECT_NO_THROW(search(config));
+
+    EXPECT_TRUE(string_from_file("uncached.out") == string_from_file("cached.out"));
+}
+
+TEST_F(api_search_test, mixed_read_lengths)
+{
+    // Trimmed copies of the queries: each read length gets its own threshold.
+    {
+        std::ifstream query{data("query.fq")};
+        std::ofstream reads{"mixed_reads.fq"};
+        std::string id, sequence, plus, quality;
+        while (std::getline(query, id) && std::getline(query, sequence) && std::getline(query, plus)
+               && std::getline(query, quality))
+        {
+            for (size_t const length : {60u, 50u, 40u})
+                reads << id << '\n'
+                      << sequence.substr(0, length) << '\n'
+                      << plus << '\n'
+                      << quality.substr(0, length) << '\n';
+        }
+    }
+
+    configuration config{};
+    config.reads = "mixed_reads.fq";
+    config.index_file = data("minimiser.index");
+    config.error = 1u;
+    config.threshold_cache = "mixed_cache";
+    config.search_output = "mixed.out";
+
+    EXPECT_NO_THROW(search(config));
+
+    size_t cached_files{};
+    for ([[maybe_unused]] auto const & entry : std::filesystem::directory_iterator{config.threshold_cache})
+        ++cached_files;
+    EXPECT_EQ(cached_files, 6u); // Thresholds and correction for each of the three read lengths.
+
+    EXPECT_EQ(std::ranges::count(string_from_file("mixed.out"), '\n'), 9);
+}
+
+TEST_F(api_search_test, stats)
+{
+    configuration config{};
+    config.reads = data("query.fq");
+    config.index_file = data("minimiser.index");
+    config.search_output = "stats.out";
+    config.stats_output = "search_stats.json";
+
+    EXPECT_NO_THROW(search(config));
+
+    EXPECT_EQ("query1: [0]\n"
+              "query2: [1]\n"
+              "query3: [2]\n",
+              string_from_file("stats.out"));
+
+    std::string const stats = string_from_file("search_stats.json");
+    EXPECT_TRUE(stats.starts_with("{\n  \"command\": \"search\",")) << stats;
+    for (std::string const key : {"\"load\": {\"wall_seconds\": ",
+                                  "\"threshold_setup\": {\"wall_seconds\": ",
+                                  "\"membership\": {\"thread_seconds\": ",
+                                  "\"reads\": 3\n",
+                                  "\"bases\": 180,",
+                                  "\"bytes_written\": 36,",
+                                  "\"hits_per_read\": {\"count\": 3, \"sum\": 3, \"min\": 1, \"max\": 1, \"mean\": 1}",
+                                  "\"peak_rss_bytes\": "})
+        EXPECT_NE(stats.find(key), std::string::npos) << key;
+}
+
+TEST_F(api_search_test, named_pipe)
+{
+    ASSERT_EQ(::mkfifo("reads.fq", 0600), 0);
+    std::thread producer{[]()
+                         {
+                             std::ofstream pipe{"reads.fq"};
+                             pipe << string_from_file(data("query.fq"));
+                         }};
+
+    configuration config{};
+    config.reads = "reads.fq";
+    config.index_file = data("minimiser.index");
+    config.search_output = "pipe.out";
+    config.stats_output = "pipe_stats.json";
+
+    EXPECT_NO_THROW(search(config));
+    producer.join();
+
+    EXPECT_EQ("query1: [0]\n"
+              "query2: [1]\n"
+              "query3: [2]\n",
+              string_from_file("pipe.out"));
+
+    // Only the index counts towards the bytes read.
+    std::string const bytes_read = "\"bytes_read\": " + std::to_string(std::filesystem::file_size(config.index_file));
+    EXPECT_NE(string_from_file("pipe_stats.json").find(bytes_read), std::string::npos);
+}
+
+TEST_F(api_search_test, output_formats)
+{
+    configuration config{};
+    config.reads = data("query.fq");
+    config.index_file = data("minimiser.index");
+
+    config.output_format = result_format::tsv;
+    config.search_output = "result.tsv";
+    EXPECT_NO_THROW(search(config));
+    EXPECT_EQ("query1\t0\n"
+              "query2\t1\n"
+              "query3\t2\n",
+              string_from_file("result.tsv"));
+
+    config.output_format = result_format::binary;
+    config.search_output = "result.bin";
+    EXPECT_NO_THROW(search(config));
+    std::string const binary = string_from_file("result.bin", std::ios::binary);
+    EXPECT_EQ(binary, "HIBFRES" + std::string({1, 0, 0, 1, 0, 1, 1, 1, 2, 1, 2}));
+
+    // Decoding yields the header, then read index, number of user bins, and the user bins.
+    std::span<char const> data{binary};
+    binary_result_header header{};
+    ASSERT_TRUE(read_binary_header(data, header));
+    EXPECT_EQ(header.version, binary_result_header::current_version);
+    EXPECT_EQ(header.flags, 0u);
+    for (uint64_t read = 0; read < 3u; ++read)
+    {
+        uint64_t value{};
+        ASSERT_TRUE(read_varint(data, value));
+        EXPECT_EQ(value, read);
+        ASSERT_TRUE(read_varint(data, value));
+        EXPECT_EQ(value, 1u);
+        ASSERT_TRUE(read_varint(data, value));
+        EXPECT_EQ(value, read);
+    }
+    EXPECT_TRUE(data.empty());
+}
+
+TEST_F(api_search_test, varint)
+{
+    std::vector<uint64_t> const values{0u, 127u, 128u, 300u, std::numeric_limits<uint64_t>::max()};
+    std::string encoded;
+    for (uint64_t const value : values)
+        append_varint(encoded, value);
+    EXPECT_EQ(encoded.size(), 1u + 1u + 2u + 2u + 10u);
+
+    std::span<char const> data{encoded};
+    for (uint64_t const expected : values)
+    {
+        uint64_t value{};
+        ASSERT_TRUE(read_varint(data, value));
+        EXPECT_EQ(value, expected);
+    }
+    EXPECT_TRUE(data.empty());
+
+    // Truncated input.
+    std::string const truncated{static_cast<char>(0x80)};
+    std::span<char const> rest{truncated};
+    uint64_t value{};
+    EXPECT_FALSE(read_varint(rest, value));
+}
+
+TEST_F(api_search_test, counts)
+{
+    configuration config{};
+    config.reads = data("query.fq");
+    config.index_file = data("minimiser.index");
+    config.count_hashes = true;
+    config.search_output = "counts.out";
+
+    EXPECT_NO_THROW(search(config));
+
+    // `id: <hashes> hashes, thresholds [<threshold>], counts [<own user bin>:<hashes>]`: each read contains only
+    // hashes of its own user bin. Without errors, the threshold is the number of hashes.
+    std::istringstream lines{string_from_file("counts.out")};
+    std::string line;
+    for (size_t read = 0; read < 3u; ++read)
+    {
+        ASSERT_TRUE(std::getline(lines, line));
+        std::string const prefix = "query" + std::to_string(read + 1u) + ": ";
+        ASSERT_TRUE(line.starts_with(prefix)) << line;
+        std::string const hashes = line.substr(prefix.size(), line.find(' ', prefix.size()) - prefix.size());
+        EXPECT_EQ(line,
+                  prefix + hashes + " hashes, thresholds [" + hashes + "], counts [" + std::to_string(read) + ':'
+                      + hashes + ']');
+    }
+    EXPECT_FALSE(std::getline(lines, line));
+
+    config.output_format = result_format::tsv;
+    config.search_output = "counts.tsv";
+    EXPECT_NO_THROW(search(config));
+    EXPECT_EQ(std::ranges::count(string_from_file("counts.tsv"), '\t'), 3 * 4);
+
+    // One threshold per error level.
+    config.error = 2u;
+    EXPECT_NO_THROW(search(config));
+    EXPECT_EQ(std::ranges::count(string_from_file("counts.tsv"), ','), 3 * 2);
+
+    // Binary count files are marked as such.
+    config.output_format = result_format::binary;
+    config.search_output = "counts.bin";
+    EXPECT_NO_THROW(search(config));
+    std::string const binary = string_from_file("counts.bin", std::ios::binary);
+    std::span<char const> data{binary};
+    binary_result_header header{};
+    ASSERT_TRUE(read_binary_header(data, header));
+    EXPECT_EQ(header.flags, binary_result_header::counts_flag);
+
+    std::string const not_binary = string_from_file("counts.tsv");
+    data = not_binary;
+    EXPECT_FALSE(read_binary_header(data, header));
+}
+
+TEST_F(api_search_test, write_error)
+{
+    if (!std::filesystem::exists("/dev/full"))
+        GTEST_SKIP() << "/dev/full is not available.";
+
+    result_writer writer{"/dev/full", false};
+    writer.write("query1: [0]\n");
+    EXPECT_THROW(writer.flush(), std::runtime_error);
+}
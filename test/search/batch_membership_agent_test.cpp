@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <random>
+
+#include "../app_test.hpp"
+#include <hash/hash.hpp>
+#include <index_data.hpp>
+#include <search/batch_membership_agent.hpp>
+
+struct batch_membership_agent_test : public app_test
+{};
+
+// Random queries mixing hashes of several user bins, with thresholds from zero to all hashes.
+TEST_F(batch_membership_agent_test, same_as_membership_agent)
+{
+    for (std::string const index_file : {"kmer.index", "minimiser.index", "syncmer.index"})
+    {
+        myindex index{};
+        index.load(data(index_file));
+
+        // Hashes of all user bins, and some that are not in the index.
+        hash_parameters const parameters{.hash = index.hash,
+                                         .kmer_size = index.kmer_size,
+                                         .window_size = index.window_size,
+                                         .s = index.s,
+                                         .t = index.t};
+        std::vector<uint64_t> hash_pool(100u);
+        std::iota(hash_pool.begin(), hash_pool.end(), 0u);
+        for (std::string const user_bin : {"bin1.fa", "bin2.fa", "bin3.fa", "bin4.fa"})
+        {
+            std::vector<uint64_t> hashes;
+            hash_user_bin(data(user_bin), parameters, hashes);
+            hash_pool.insert(hash_pool.end(), hashes.begin(), hashes.end());
+        }
+
+        std::mt19937_64 engine{42u};
+        std::vector<std::vector<uint64_t>> queries(200u);
+        std::vector<uint16_t> thresholds;
+        for (auto & query : queries)
+        {
+            query.resize(engine() % 50u);
+            for (uint64_t & hash : query)
+                hash = hash_pool[engine() % hash_pool.size()];
+            thresholds.push_back(query.empty() ? 0u : engine() % (query.size() + 1u));
+        }
+
+        batch_membership_agent batch_agent{index.hibf};
+        for (size_t i = 0; i < queries.size(); ++i)
+            batch_agent.add(queries[i], thresholds[i]);
+        batch_agent.query();
+
+        auto agent = index.hibf.membership_agent();
+        for (size_t i = 0; i < queries.size(); ++i)
+        {
+            auto & expected = agent.membership_for(queries[i], thresholds[i]);
+            agent.sort_results();
+
+            std::span<uint64_t const> const actual = batch_agent.result(i);
+            EXPECT_TRUE(std::ranges::equal(actual, expected)) << index_file << ", query " << i;
+        }
+
+        // The agent can be reused.
+        batch_agent.clear();
+        EXPECT_EQ(batch_agent.size(), 0u);
+        batch_agent.add(queries[0], thresholds[0]);
+        batch_agent.query();
+        EXPECT_TRUE(std::ranges::equal(batch_agent.result(0), agent.membership_for(queries[0], thresholds[0])));
+    }
+}
@@ -85,7 +85,8 @@ TEST_P(search_test, run)
                                                number_of_errors,
                                                "--reads",
                                                data("query.fq"),
-                                               "--output result.out");
+                                               "--output result.out",
+                                               "--print_results");
 
     EXPECT_SUCCESS(result);
     ASSERT_TRUE(std::filesystem::exists("result.out"));
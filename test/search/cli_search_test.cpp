@@ -2,6 +2,8 @@
 // SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
 // SPDX-License-Identifier: CC0-1.0
 
+#include <fstream>
+
 #include "../app_test.hpp"
 
 // To prevent issues when running multiple CLI tests in parallel, give each CLI test unique names:
@@ -49,7 +51,8 @@ TEST_F(cli_search_test, with_arguments_kmer)
                                                data("kmer.index"),
                                                "--reads",
                                                data("query.fq"),
-                                               "--output result.out");
+                                               "--output result.out",
+                                               "--print_results");
 
     std::string const expected{"The following hits were found:\n"
                                "query1: [0]\n"
@@ -71,7 +74,8 @@ TEST_F(cli_search_test, with_arguments_minimiser)
                                                data("minimiser.index"),
                                                "--reads",
                                                data("query.fq"),
-                                               "--output result.out");
+                                               "--output result.out",
+                                               "--print_results");
 
     std::string const expected{"The following hits were found:\n"
                                "query1: [0]\n"
@@ -93,7 +97,8 @@ TEST_F(cli_search_test, with_arguments_syncmer)
                                                data("syncmer.index"),
                                                "--reads",
                                                data("query.fq"),
-                                               "--output result.out");
+                                               "--output result.out",
+                                               "--print_results");
 
     std::string const expected{"The following hits were found:\n"
                                "query1: [0]\n"
@@ -107,6 +112,63 @@ TEST_F(cli_search_test, with_arguments_syncmer)
     EXPECT_EQ(result.err, "");
 }
 
+TEST_F(cli_search_test, with_arguments_threads)
+{
+    app_test_result const result = execute_app("HIBF-hashing",
+                                               "search",
+                                               "--index",
+                                               data("minimiser.index"),
+                                               "--reads",
+                                               data("query.fq"),
+                                               "--output result.out",
+                                               "--print_results",
+                                               "--threads 4");
+
+    std::string const expected{"The following hits were found:\n"
+                               "query1: [0]\n"
+                               "query2: [1]\n"
+                               "query3: [2]\n"};
+
+    EXPECT_SUCCESS(result);
+    EXPECT_EQ(result.out, expected);
+    EXPECT_EQ(result.err, "");
+}
+
+TEST_F(cli_search_test, standard_input)
+{
+    for (std::string const reads : {"query.fq", "query.fa"})
+    {
+        if (reads == "query.fa")
+        {
+            std::ifstream query{data("query.fq")};
+            std::ofstream fasta{reads};
+            std::string id, sequence, plus, quality;
+            while (std::getline(query, id) && std::getline(query, sequence) && std::getline(query, plus)
+                   && std::getline(query, quality))
+                fasta << '>' << id.substr(1) << '\n' << sequence << '\n';
+        }
+
+        app_test_result const result = execute_app("HIBF-hashing",
+                                                   "search",
+                                                   "--index",
+                                                   data("minimiser.index"),
+                                                   "--reads -",
+                                                   "--output result.out",
+                                                   "--print_results",
+                                                   "<",
+                                                   reads == "query.fq" ? data(reads) : std::filesystem::path{reads});
+
+        std::string const expected{"The following hits were found:\n"
+                                   "query1: [0]\n"
+                                   "query2: [1]\n"
+                                   "query3: [2]\n"};
+
+        EXPECT_SUCCESS(result);
+        EXPECT_EQ(result.out, expected) << reads;
+        EXPECT_EQ(result.err, "");
+    }
+}
+
 TEST_F(cli_search_test, missing_path)
 {
     app_test_result const result =
@@ -0,0 +1,134 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#include <seqan3/io/sequence_file/input.hpp>
+
+#include "../app_test.hpp"
+#include <dna4_traits.hpp>
+#include <search/searcher.hpp>
+
+struct searcher_test : public app_test
+{
+    std::vector<std::vector<seqan3::dna4>> reads() const
+    {
+        std::vector<std::vector<seqan3::dna4>> sequences;
+        for (auto & record : seqan3::sequence_file_input<dna4_traits>{data("query.fq")})
+            sequences.push_back(record.sequence());
+        return sequences;
+    }
+};
+
+TEST_F(searcher_test, query)
+{
+    std::vector<std::vector<seqan3::dna4>> const sequences = reads();
+
+    for (std::string const index_file : {"kmer.index", "minimiser.index", "syncmer.index"})
+    {
+        configuration config{};
+        config.index_file = data(index_file);
+        searcher const index_searcher{config};
+
+        ASSERT_EQ(sequences.size(), 3u);
+        for (uint64_t i = 0; i < sequences.size(); ++i)
+            EXPECT_EQ(index_searcher.query(sequences[i]), std::vector<uint64_t>{i}) << index_file;
+
+        // Far too short to have any hash.
+        EXPECT_TRUE(index_searcher.query(std::vector<seqan3::dna4>(5u)).empty());
+    }
+}
+
+TEST_F(searcher_test, batch_equals_single_queries)
+{
+    std::vector<std::vector<seqan3::dna4>> const sequences = reads();
+    std::vector<std::span<seqan3::dna4 const>> batch(sequences.begin(), sequences.end());
+
+    configuration config{};
+    config.error = 2u;
+
+    myindex index{};
+    index.load(data("minimiser.index"));
+    searcher const index_searcher{std::move(index), config};
+
+    std::vector<std::vector<uint64_t>> results{{42u}, {42u}, {42u}, {42u}}; // Reused and resized.
+    index_searcher.query_batch(batch, results);
+
+    ASSERT_EQ(results.size(), sequences.size());
+    for (size_t i = 0; i < sequences.size(); ++i)
+        EXPECT_EQ(results[i], index_searcher.query(sequences[i]));
+}
+
+TEST_F(searcher_test, count)
+{
+    std::vector<std::vector<seqan3::dna4>> const sequences = reads();
+
+    configuration config{};
+    config.index_file = data("minimiser.index");
+
+    for (uint8_t const errors : {0u, 2u})
+    {
+        config.error = errors;
+        searcher const index_searcher{config};
+
+        for (uint64_t i = 0; i < sequences.size(); ++i)
+        {
+            count_result const result = index_searcher.count(sequences[i]);
+            EXPECT_EQ(result.user_bins, index_searcher.query(sequences[i]));
+            ASSERT_EQ(result.counts.size(), result.user_bins.size());
+
+            // Each read is taken from its user bin, so the user bin contains all hashes.
+            auto const own_bin = std::ranges::find(result.user_bins, i);
+            ASSERT_NE(own_bin, result.user_bins.end());
+            EXPECT_EQ(result.counts[own_bin - result.user_bins.begin()], result.hash_count);
+            EXPECT_GT(result.hash_count, 0u);
+
+            // One threshold per error level; more errors never need more hashes.
+            ASSERT_EQ(result.thresholds.size(), errors + 1u);
+            EXPECT_EQ(result.thresholds[0], result.hash_count);
+            EXPECT_TRUE(std::ranges::is_sorted(result.thresholds, std::ranges::greater{}));
+        }
+
+        // A read shorter than the window has no hashes and no counts; every threshold is 1.
+        count_result const short_read = index_searcher.count(std::vector<seqan3::dna4>(5u));
+        EXPECT_EQ(short_read.hash_count, 0u);
+        EXPECT_EQ(short_read.thresholds, std::vector<uint64_t>(errors + 1u, 1u));
+        EXPECT_TRUE(short_read.user_bins.empty());
+        EXPECT_TRUE(short_read.counts.empty());
+    }
+}
+
+TEST_F(searcher_test, concurrent_queries)
+{
+    std::vector<std::vector<seqan3::dna4>> const sequences = reads();
+
+    configuration config{};
+    config.index_file = data("minimiser.index");
+    config.error = 1u;
+    searcher const index_searcher{config};
+
+    std::vector<std::vector<uint64_t>> expected;
+    for (auto const & sequence : sequences)
+        expected.push_back(index_searcher.query(sequence));
+
+    std::vector<std::thread> threads;
+    std::atomic<size_t> mismatches{};
+    for (size_t t = 0; t < 4u; ++t)
+        threads.emplace_back(
+            [&]()
+            {
+                for (size_t repeat = 0; repeat < 100u; ++repeat)
+                    for (size_t i = 0; i < sequences.size(); ++i)
+                        if (index_searcher.query(sequences[i]) != expected[i])
+                            ++mismatches;
+            });
+    for (std::thread & thread : threads)
+        thread.join();
+
+    EXPECT_EQ(mismatches.load(), 0u);
+}
@@ -0,0 +1,96 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include "../app_test.hpp"
+#include <search/thresholder.hpp>
+
+struct thresholder_test : public app_test
+{};
+
+TEST_F(thresholder_test, per_read_length)
+{
+    configuration config{};
+    config.error = 2u;
+
+    myindex index{};
+    index.load(data("minimiser.index"));
+
+    thresholder const thresholds{config, index};
+
+    for (size_t const query_length : {60u, 100u, 150u, 100u})
+    {
+        threshold::threshold const expected{threshold::threshold_parameters{.window_size = index.window_size,
+                                                                            .shape = seqan3::ungapped{index.kmer_size},
+                                                                            .query_length = query_length,
+                                                                            .errors = config.error}};
+
+        for (size_t hash_count = 0u; hash_count <= query_length; ++hash_count)
+            EXPECT_EQ(thresholds.get(query_length, hash_count), expected.get(hash_count)) << query_length;
+    }
+}
+
+TEST_F(thresholder_test, long_reads)
+{
+    EXPECT_EQ(thresholder::length_bucket(256u), 256u);
+    EXPECT_EQ(thresholder::length_bucket(257u), 256u);
+    EXPECT_EQ(thresholder::length_bucket(1003u), 1000u);
+    EXPECT_EQ(thresholder::length_bucket(1u << 20), 1u << 20);
+    EXPECT_EQ(thresholder::length_bucket((1u << 20) + 4095u), 1u << 20);
+
+    configuration config{};
+    config.error = 2u;
+
+    myindex index{};
+    index.load(data("minimiser.index"));
+
+    thresholder const thresholds{config, index};
+    threshold::threshold const expected{threshold::threshold_parameters{.window_size = index.window_size,
+                                                                        .shape = seqan3::ungapped{index.kmer_size},
+                                                                        .query_length = 1000u,
+                                                                        .errors = config.error}};
+
+    // Several threads asking for the same length at once.
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < 4u; ++i)
+        threads.emplace_back(
+            [&]()
+            {
+                for (size_t hash_count = 0u; hash_count <= 1000u; hash_count += 100u)
+                    EXPECT_EQ(thresholds.get(1003u, hash_count), expected.get(hash_count));
+            });
+    for (std::thread & thread : threads)
+        thread.join();
+}
+
+TEST_F(thresholder_test, shorter_than_window)
+{
+    configuration config{};
+    myindex index{};
+    index.load(data("minimiser.index"));
+
+    EXPECT_EQ((thresholder{config, index}.get(10u, 3u)), 3u);
+    EXPECT_EQ((thresholder{config, index}.get(10u, 0u)), 1u); // Reads without hashes are never found.
+
+    config.error = 1u;
+    EXPECT_EQ((thresholder{config, index}.get(10u, 0u)), 1u);
+}
+
+TEST_F(thresholder_test, syncmer)
+{
+    configuration config{};
+    config.error = 2u;
+
+    myindex index{};
+    index.load(data("syncmer.index"));
+
+    thresholder const thresholds{config, index};
+
+    EXPECT_EQ(thresholds.get(60u, 40u), index.syncmer_model.get(40u, 2u));
+    EXPECT_EQ(thresholds.get(150u, 40u), index.syncmer_model.get(40u, 2u));
+}
@@ -0,0 +1,195 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <thread>
+
+#include <sys/socket.h>
+
+#include "../app_test.hpp"
+#include <search/search.hpp>
+#include <serve/protocol.hpp>
+#include <serve/serve.hpp>
+
+// To prevent issues when running multiple API tests in parallel, give each API test unique names:
+struct api_serve_test : public app_test
+{
+    // Runs the server on its own thread until `stop_server()` is called.
+    void start_server(configuration const & config)
+    {
+        server = std::thread{[config]()
+                             {
+                                 EXPECT_NO_THROW(serve(config));
+                             }};
+
+        for (size_t i = 0; i < 1000u && !std::filesystem::is_socket(config.socket_path); ++i)
+            std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        ASSERT_TRUE(std::filesystem::is_socket(config.socket_path));
+    }
+
+    void stop_server(configuration config)
+    {
+        config.shutdown_server = true;
+        EXPECT_NO_THROW(client(config));
+        server.join();
+        EXPECT_FALSE(std::filesystem::exists(config.socket_path));
+    }
+
+    std::thread server{};
+};
+
+TEST_F(api_serve_test, same_results_as_search)
+{
+    configuration config{};
+    config.index_file = data("minimiser.index");
+    config.reads = data("query.fq");
+    config.socket_path = "search.sock";
+    config.error = 1u;
+    config.threads = 2u;
+
+    config.search_output = "search.out";
+    search(config);
+
+    testing::internal::CaptureStdout();
+    start_server(config);
+
+    // Several clients at once.
+    std::vector<std::thread> clients;
+    for (size_t i = 0; i < 4u; ++i)
+        clients.emplace_back(
+            [config, i]() mutable
+            {
+                config.search_output = "client" + std::to_string(i) + ".out";
+                EXPECT_NO_THROW(client(config));
+            });
+    for (std::thread & thread : clients)
+        thread.join();
+
+    stop_server(config);
+    std::string const server_cout = testing::internal::GetCapturedStdout();
+
+    for (size_t i = 0; i < 4u; ++i)
+        EXPECT_EQ(string_from_file("client" + std::to_string(i) + ".out"), string_from_file("search.out"));
+
+    EXPECT_TRUE(server_cout.starts_with("Serving ")) << server_cout;
+    EXPECT_NE(server_cout.find(": 3 reads in "), std::string::npos) << server_cout;
+    EXPECT_TRUE(server_cout.ends_with("Server stopped after 4 request(s).\n")) << server_cout;
+}
+
+TEST_F(api_serve_test, fasta_and_invalid_requests)
+{
+    configuration config{};
+    config.index_file = data("minimiser.index");
+    config.socket_path = "fasta.sock";
+
+    {
+        std::ifstream query{data("query.fq")};
+        std::ofstream reads{"query.fa"};
+        std::string id, sequence, plus, quality;
+        while (std::getline(query, id) && std::getline(query, sequence) && std::getline(query, plus)
+               && std::getline(query, quality))
+            reads << '>' << id.substr(1) << '\n' << sequence << '\n';
+    }
+    {
+        std::ofstream reads{"invalid.txt"};
+        reads << "ACGT\n";
+    }
+
+    testing::internal::CaptureStdout();
+    start_server(config);
+
+    config.reads = "query.fa";
+    config.search_output = "fasta.out";
+    EXPECT_NO_THROW(client(config));
+
+    // The server reports the error and keeps running.
+    config.reads = "invalid.txt";
+    config.search_output = "invalid.out";
+    EXPECT_THROW(client(config), std::runtime_error);
+
+    // A missing file fails in the client, without waiting for the server.
+    config.reads = "missing.fq";
+    EXPECT_THROW(client(config), std::runtime_error);
+
+    stop_server(config);
+    testing::internal::GetCapturedStdout();
+
+    EXPECT_EQ("query1: [0]\n"
+              "query2: [1]\n"
+              "query3: [2]\n",
+              string_from_file("fasta.out"));
+}
+
+TEST_F(api_serve_test, framing)
+{
+    auto const [first, second] = unix_socket::pair();
+
+    write_message(first.get(), message_type::search, "@read\nACGT\n+\nIIII\n");
+    write_message(first.get(), message_type::shutdown, {});
+    ::shutdown(first.get(), SHUT_WR);
+
+    message msg{};
+    ASSERT_TRUE(read_message(second.get(), msg, 1024u));
+    EXPECT_EQ(msg.type, message_type::search);
+    EXPECT_EQ(msg.payload, "@read\nACGT\n+\nIIII\n");
+    ASSERT_TRUE(read_message(second.get(), msg, 1024u));
+    EXPECT_EQ(msg.type, message_type::shutdown);
+    EXPECT_EQ(msg.payload, "");
+    EXPECT_FALSE(read_message(second.get(), msg, 1024u));
+
+    // The announced size is checked before anything is allocated.
+    auto const [sender, receiver] = unix_socket::pair();
+    write_message(sender.get(), message_type::search, "@read\nACGT\n+\nIIII\n");
+    EXPECT_THROW(read_message(receiver.get(), msg, 4u), message_too_large);
+
+    // Waiting for a silent peer times out.
+    auto const [silent, waiting] = unix_socket::pair();
+    waiting.set_receive_timeout(1u);
+    EXPECT_THROW(read_message(waiting.get(), msg, 1024u), receive_timeout);
+}
+
+TEST_F(api_serve_test, limits)
+{
+    configuration config{};
+    config.index_file = data("minimiser.index");
+    config.socket_path = "limits.sock";
+    config.max_request_size = 1u;
+    config.idle_timeout = 1u;
+
+    {
+        std::string const query = string_from_file(data("query.fq"));
+        std::ofstream reads{"large.fq"};
+        while (reads.tellp() <= (1 << 20))
+            reads << query;
+    }
+
+    testing::internal::CaptureStdout();
+    testing::internal::CaptureStderr();
+    start_server(config);
+
+    config.reads = "large.fq";
+    config.search_output = "large.out";
+    EXPECT_THROW(client(config), std::runtime_error);
+
+    // An idle client is disconnected and does not block the only worker.
+    {
+        unix_socket const idle = unix_socket::connect(config.socket_path);
+        message msg{};
+        EXPECT_FALSE(read_message(idle.get(), msg, 1024u));
+    }
+
+    config.reads = data("query.fq");
+    config.search_output = "small.out";
+    EXPECT_NO_THROW(client(config));
+
+    stop_server(config);
+    testing::internal::GetCapturedStdout();
+    testing::internal::GetCapturedStderr();
+
+    EXPECT_EQ(std::ranges::count(string_from_file("small.out"), '\n'), 3);
+}
@@ -0,0 +1,47 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <gtest/gtest.h>
+
+#include "syncmer_threshold.hpp"
+
+TEST(syncmer_threshold_test, thresholds)
+{
+    // k = 15, s = 11: each of the 15 k-mers overlapping an error is a syncmer with probability 1/5.
+    syncmer_threshold const model{15u, 11u};
+
+    EXPECT_FALSE(model.empty());
+    EXPECT_EQ(model.get(100u, 0u), 100u);
+    EXPECT_EQ(model.get(100u, 1u), 90u);
+    EXPECT_EQ(model.get(100u, 2u), 85u);
+    EXPECT_EQ(model.get(100u, 3u), 80u);
+    EXPECT_EQ(model.get(100u, 4u), 75u);
+    EXPECT_EQ(model.get(100u, 5u), 71u);
+}
+
+TEST(syncmer_threshold_test, every_kmer_is_a_syncmer)
+{
+    // s = k: every k-mer is a syncmer, so an error destroys exactly k syncmers.
+    syncmer_threshold const model{20u, 20u};
+
+    EXPECT_EQ(model.get(100u, 1u), 80u);
+    EXPECT_EQ(model.get(100u, 2u), 60u);
+}
+
+TEST(syncmer_threshold_test, threshold_is_at_least_one)
+{
+    syncmer_threshold const model{15u, 11u};
+
+    EXPECT_EQ(model.get(3u, 5u), 1u);
+    EXPECT_EQ(model.get(0u, 1u), 1u);
+    EXPECT_EQ(model.get(0u, 0u), 0u);
+}
+
+TEST(syncmer_threshold_test, invalid)
+{
+    EXPECT_THROW((syncmer_threshold{15u, 16u}), std::invalid_argument);
+    EXPECT_THROW((syncmer_threshold{15u, 0u}), std::invalid_argument);
+    EXPECT_THROW(syncmer_threshold{}.get(100u, 1u), std::invalid_argument);
+    EXPECT_THROW((syncmer_threshold{15u, 11u}.get(100u, 6u)), std::invalid_argument);
+}
@@ -0,0 +1,102 @@
+// SPDX-FileCopyrightText: 2006-2025 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2025 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <gtest/gtest.h>
+
+#include "../app_test.hpp"
+#include <search/search.hpp>
+#include <update/update.hpp>
+
+// To prevent issues when running multiple API tests in parallel, give each API test unique names:
+struct api_update_test : public app_test
+{
+    std::string search_results(std::filesystem::path const & index_file)
+    {
+        configuration config{};
+        config.reads = data("query.fq");
+        config.index_file = index_file;
+        config.search_output = "update.out";
+        search(config);
+        return string_from_file("update.out");
+    }
+};
+
+TEST_F(api_update_test, remove_and_add)
+{
+    configuration config{};
+    config.index_file = data("minimiser.index");
+    config.index_output = "removed.index";
+    config.user_bins_to_remove = {1u};
+
+    testing::internal::CaptureStdout();
+    EXPECT_NO_THROW(update(config));
+    EXPECT_EQ("Removed user bins: 1\n"
+              "Added user bins: 0\n"
+              "HIBF index updated and saved to \"removed.index\"\n",
+              testing::internal::GetCapturedStdout());
+
+    EXPECT_EQ("query1: [0]\n"
+              "query2: []\n"
+              "query3: [2]\n",
+              search_results("removed.index"));
+
+    // Adding the removed file again reuses its technical bins under a new ID.
+    {
+        std::ofstream file_list{"add.txt"};
+        file_list << data("bin2.fa").string() << '\n';
+    }
+    config.index_file = "removed.index";
+    config.index_output = "added.index";
+    config.file_list_path = "add.txt";
+    config.user_bins_to_remove.clear();
+
+    testing::internal::CaptureStdout();
+    EXPECT_NO_THROW(update(config));
+    EXPECT_EQ("Removed user bins: 0\n"
+              "Added user bins: 1\n"
+              "IDs of the added user bins: 4 to 4\n"
+              "HIBF index updated and saved to \"added.index\"\n",
+              testing::internal::GetCapturedStdout());
+
+    EXPECT_EQ("query1: [0]\n"
+              "query2: [4]\n"
+              "query3: [2]\n",
+              search_results("added.index"));
+}
+
+TEST_F(api_update_test, rebuild_recommendation)
+{
+    configuration config{};
+    config.index_file = data("syncmer.index");
+    config.index_output = "mostly_removed.index";
+    config.user_bins_to_remove = {0u, 2u};
+
+    testing::internal::CaptureStdout();
+    EXPECT_NO_THROW(update(config));
+    EXPECT_EQ("Removed user bins: 2\n"
+              "Added user bins: 0\n"
+              "HIBF index updated and saved to \"mostly_removed.index\"\n"
+              "A full rebuild is recommended: 2 of 4 user bins are removed.\n",
+              testing::internal::GetCapturedStdout());
+
+    EXPECT_EQ("query1: []\n"
+              "query2: [1]\n"
+              "query3: []\n",
+              search_results("mostly_removed.index"));
+}
+
+TEST_F(api_update_test, invalid_user_bin)
+{
+    configuration config{};
+    config.index_file = data("minimiser.index");
+    config.index_output = "invalid.index";
+
+    config.user_bins_to_remove = {4u};
+    EXPECT_THROW(update(config), std::invalid_argument);
+
+    config.user_bins_to_remove = {1u, 1u};
+    EXPECT_THROW(update(config), std::invalid_argument);
+
+    EXPECT_FALSE(std::filesystem::exists("invalid.index"));
+}